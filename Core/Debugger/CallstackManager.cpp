@@ -3,74 +3,151 @@
 #include "Debugger/Debugger.h"
 #include "Debugger/DebugBreakHelper.h"
 #include "Debugger/Profiler.h"
+#include "Debugger/SamplingProfiler.h"
 
 CallstackManager::CallstackManager(Debugger* debugger, IConsole* console)
-    : _debugger(debugger), _profiler(std::make_unique<Profiler>(debugger, console)) {}
+    : _debugger(debugger), _profiler(std::make_unique<Profiler>(debugger, console)), _samplingProfiler(std::make_unique<SamplingProfiler>(debugger, console)) {}
 
 CallstackManager::~CallstackManager() = default;
 
 void CallstackManager::Push(AddressInfo& src, uint32_t srcAddr, AddressInfo& dest, uint32_t destAddr, AddressInfo& ret, uint32_t returnAddress, StackFrameFlags flags) {
-    if (_callstack.size() >= 511) {
-        _callstack.pop_front(); // Ensure callstack stays below 512 entries
+    BeginUpdate();
+
+    if (_size == MaxCallstackSize) {
+        // Callstack is full, drop the oldest frame
+        _start = (_start + 1) & CallstackMask;
+        _size--;
+        _overflowCount++;
     }
 
-    StackFrameInfo stackFrame = {
-        srcAddr,
-        src,
-        destAddr,
-        dest,
-        returnAddress,
-        ret,
-        flags
-    };
-
-    _callstack.emplace_back(std::move(stackFrame));
-    _profiler->StackFunction(dest, flags);
+    StackFrameInfo& stackFrame = GetFrame(_size);
+    stackFrame.Source = srcAddr;
+    stackFrame.AbsSource = src;
+    stackFrame.Target = destAddr;
+    stackFrame.AbsTarget = dest;
+    stackFrame.Return = returnAddress;
+    stackFrame.AbsReturn = ret;
+    stackFrame.Flags = flags;
+    _size++;
+
+    EndUpdate();
+
+    if (!_samplingEnabled) {
+        _profiler->StackFunction(dest, flags);
+    }
+}
+
+void CallstackManager::PopFrame() {
+    _size--;
+    if (!_samplingEnabled) {
+        _profiler->UnstackFunction();
+    }
 }
 
 void CallstackManager::Pop(AddressInfo& dest, uint32_t destAddress) {
-    if (_callstack.empty()) {
+    if (_size == 0) {
         return;
     }
 
-    auto& prevFrame = _callstack.back();
-    _callstack.pop_back();
-    _profiler->UnstackFunction();
+    BeginUpdate();
+
+    StackFrameInfo prevFrame = GetFrame(_size - 1);
+    PopFrame();
 
     uint32_t returnAddr = prevFrame.Return;
 
-    if (!_callstack.empty() && destAddress != returnAddr) {
-        auto it = std::find_if(_callstack.rbegin(), _callstack.rend(), [returnAddr](const auto& frame) {
-            return frame.Return == returnAddr;
-        });
+    if (_size > 0 && destAddress != returnAddr) {
+        // Mismatch, try to find a matching address higher in the stack
+        bool foundMatch = false;
+        for (int32_t i = (int32_t)_size - 1; i >= 0; i--) {
+            if (GetFrame(i).Return == destAddress) {
+                // Found a matching stack frame, unstack until that point
+                foundMatch = true;
+                while ((int32_t)_size > i) {
+                    PopFrame();
+                }
+                break;
+            }
+        }
 
-        if (it != _callstack.rend()) {
-            // Found a matching stack frame, unstack until that point
-            _callstack.erase(it.base(), _callstack.end());
-            _profiler->UnstackFunction(static_cast<size_t>(std::distance(it, _callstack.end())));
-        } else {
+        if (!foundMatch) {
             // Couldn't find a matching frame, replace the current one
+            EndUpdate();
             Push(prevFrame.AbsReturn, returnAddr, dest, destAddress, prevFrame.AbsReturn, returnAddr, StackFrameFlags::None);
+            return;
         }
     }
+
+    EndUpdate();
+}
+
+bool CallstackManager::TryCopyCallstack(StackFrameInfo* callstackArray, uint32_t& callstackSize) {
+    uint32_t version = _version.load(std::memory_order_acquire);
+    if (version & 0x01) {
+        // Callstack is being modified
+        return false;
+    }
+
+    uint32_t start = _start;
+    uint32_t size = std::min(_size, MaxCallstackSize);
+    for (uint32_t i = 0; i < size; i++) {
+        callstackArray[i] = _callstack[(start + i) & CallstackMask];
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_version.load(std::memory_order_relaxed) != version) {
+        return false;
+    }
+
+    callstackSize = size;
+    return true;
 }
 
 void CallstackManager::GetCallstack(StackFrameInfo* callstackArray, uint32_t& callstackSize) {
+    // Try to copy a consistent snapshot without pausing emulation first
+    for (int i = 0; i < 10; i++) {
+        if (TryCopyCallstack(callstackArray, callstackSize)) {
+            return;
+        }
+    }
+
+    // Emulation is paused between instructions here, so the callstack can't be modified while it's copied
     DebugBreakHelper helper(_debugger);
-    callstackSize = static_cast<uint32_t>(_callstack.size());
-    std::copy(_callstack.begin(), _callstack.end(), callstackArray);
+    uint32_t size = std::min(_size, MaxCallstackSize);
+    for (uint32_t i = 0; i < size; i++) {
+        callstackArray[i] = GetFrame(i);
+    }
+    callstackSize = size;
 }
 
 int32_t CallstackManager::GetReturnAddress() {
     DebugBreakHelper helper(_debugger);
-    return _callstack.empty() ? -1 : _callstack.back().Return;
+    return _size == 0 ? -1 : GetFrame(_size - 1).Return;
 }
 
 Profiler* CallstackManager::GetProfiler() {
     return _profiler.get();
 }
 
+SamplingProfiler* CallstackManager::GetSamplingProfiler() {
+    return _samplingProfiler.get();
+}
+
+void CallstackManager::SetSamplingOptions(bool enabled, uint32_t interval) {
+    DebugBreakHelper helper(_debugger);
+    _samplingProfiler->SetOptions(enabled, interval);
+    if (_samplingEnabled != enabled) {
+        // The exact profiler's stack is not maintained while sampling, restart it from a clean state
+        _samplingEnabled = enabled;
+        _profiler->ResetState();
+    }
+}
+
 void CallstackManager::Clear() {
-    _callstack.clear();
+    BeginUpdate();
+    _start = 0;
+    _size = 0;
+    _overflowCount = 0;
+    EndUpdate();
     _profiler->ResetState();
 }
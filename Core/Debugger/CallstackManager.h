@@ -1,16 +1,50 @@
 #pragma once
 #include "pch.h"
 #include "Debugger/DebugTypes.h"
+#include "Debugger/SamplingProfiler.h"
 
 class Debugger;
 class Profiler;
 class IConsole;
 
 class CallstackManager {
+public:
+    static constexpr uint32_t MaxCallstackSize = 512;
+
 private:
+    static constexpr uint32_t CallstackMask = MaxCallstackSize - 1;
+    static_assert((MaxCallstackSize & CallstackMask) == 0, "MaxCallstackSize must be a power of 2");
+
     Debugger* _debugger;
-    std::deque<StackFrameInfo> _callstack;
+
+    // Fixed-size circular buffer - when full, the oldest frame is overwritten
+    StackFrameInfo _callstack[MaxCallstackSize] = {};
+    uint32_t _start = 0;
+    uint32_t _size = 0;
+    uint64_t _overflowCount = 0;
+
+    // Sequence counter (odd while the callstack is being modified), allows the UI
+    // to copy the callstack from another thread without pausing emulation
+    std::atomic<uint32_t> _version = 0;
+
     std::unique_ptr<Profiler> _profiler;
+    std::unique_ptr<SamplingProfiler> _samplingProfiler;
+    bool _samplingEnabled = false;
+
+    __forceinline StackFrameInfo& GetFrame(uint32_t index) { return _callstack[(_start + index) & CallstackMask]; }
+    __forceinline const StackFrameInfo& GetFrame(uint32_t index) const { return _callstack[(_start + index) & CallstackMask]; }
+
+    __forceinline void BeginUpdate() {
+        _version.store(_version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    __forceinline void EndUpdate() {
+        _version.store(_version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    bool TryCopyCallstack(StackFrameInfo* callstackArray, uint32_t& callstackSize);
+    void PopFrame();
 
 public:
     CallstackManager(Debugger* debugger, IConsole* console);
@@ -20,8 +54,8 @@ public:
     void Pop(AddressInfo& dest, uint32_t destAddr);
 
     [[nodiscard]] bool IsReturnAddrMatch(uint32_t destAddr) const noexcept {
-        for (auto it = _callstack.rbegin(); it != _callstack.rend(); ++it) {
-            if (it->Return == destAddr) {
+        for (int32_t i = (int32_t)_size - 1; i >= 0; i--) {
+            if (GetFrame(i).Return == destAddr) {
                 return true;
             }
         }
@@ -30,7 +64,19 @@ public:
 
     void GetCallstack(StackFrameInfo* callstackArray, uint32_t& callstackSize);
     int32_t GetReturnAddress();
+    uint64_t GetOverflowCount() const noexcept { return _overflowCount; }
     Profiler* GetProfiler();
+    SamplingProfiler* GetSamplingProfiler();
+
+    void SetSamplingOptions(bool enabled, uint32_t interval);
+    __forceinline bool IsSamplingEnabled() const noexcept { return _samplingEnabled; }
+
+    // Called for every instruction while sampling is enabled
+    __forceinline void ProcessSample() {
+        if (_samplingProfiler->IsSampleDue()) {
+            _samplingProfiler->RecordSample(_size, [this](uint32_t i) -> StackFrameInfo& { return GetFrame(i); });
+        }
+    }
 
     void Clear();
 };
@@ -216,6 +216,11 @@ void Debugger::ProcessInstruction()
 	}
 
 	debugger->AllowChangeProgramCounter = false;
+
+	CallstackManager* callstackManager = debugger->GetCallstackManager();
+	if(callstackManager && callstackManager->IsSamplingEnabled()) {
+		callstackManager->ProcessSample();
+	}
 	
 	if(_scriptManager->HasCpuMemoryCallbacks()) {
 		MemoryOperationInfo memOp = debugger->InstructionProgress.LastMemOperation;
@@ -53,6 +53,13 @@
 #define checkinitdone() if(!_context->CheckInitDone()) { error("This function cannot be called outside a callback"); }
 #define checksavestateconditions() if(!_context->IsSaveStateAllowed()) { error("This function must be called inside an exec memory operation callback for the main CPU"); }
 
+static constexpr const char* MemoryViewMetatable = "MesenMemoryView";
+
+struct LuaMemoryView
+{
+	MemoryType Type;
+};
+
 Debugger* LuaApi::_debugger = nullptr;
 Emulator* LuaApi::_emu = nullptr;
 MemoryDumper* LuaApi::_memoryDumper = nullptr;
@@ -97,11 +104,16 @@ int LuaApi::GetLibrary(lua_State *lua)
 
 		{ "readWord", LuaApi::ReadMemory16 }, //for backward compatibility
 		{ "writeWord", LuaApi::WriteMemory16 }, //for backward compatibility
+
+		{ "readBlock", LuaApi::ReadMemoryBlock },
+		{ "writeBlock", LuaApi::WriteMemoryBlock },
+		{ "getMemoryView", LuaApi::GetMemoryView },
 		
 		{ "convertAddress", LuaApi::ConvertAddress },
 		{ "getLabelAddress", LuaApi::GetLabelAddress },
 
 		{ "addMemoryCallback", LuaApi::RegisterMemoryCallback },
+		{ "addBatchedMemoryCallback", LuaApi::RegisterBatchedMemoryCallback },
 		{ "removeMemoryCallback", LuaApi::UnregisterMemoryCallback },
 		{ "addEventCallback", LuaApi::RegisterEventCallback },
 		{ "removeEventCallback", LuaApi::UnregisterEventCallback },
@@ -155,6 +167,7 @@ int LuaApi::GetLibrary(lua_State *lua)
 		{ "getScriptDataFolder", LuaApi::GetScriptDataFolder },
 		{ "getRomInfo", LuaApi::GetRomInfo },
 		{ "getLogWindowLog", LuaApi::GetLogWindowLog },
+		{ "getScriptTiming", LuaApi::GetScriptTiming },
 		{ NULL,NULL }
 	};
 
@@ -367,6 +380,161 @@ int LuaApi::ConvertAddress(lua_State *lua)
 	return 1;
 }
 
+int LuaApi::ReadMemoryBlock(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	l.ForceParamCount(4);
+	lua_settop(lua, 4);
+
+	//The optional 4th parameter is a table to fill, to avoid allocating a new table on each call
+	//Move it below the other parameters, it is returned once filled
+	lua_insert(lua, 1);
+
+	int type = l.ReadInteger();
+	bool disableSideEffects = (type & 0x100) == 0x100;
+	MemoryType memType = (MemoryType)(type & 0xFF);
+	int length = l.ReadInteger();
+	int address = l.ReadInteger();
+	checkminparams(3);
+	checkEnum(MemoryType, memType, "invalid memory type");
+	errorCond(!lua_isnil(lua, 1) && !lua_istable(lua, 1), "table parameter must be a table");
+
+	uint32_t memSize = _memoryDumper->GetMemorySize(memType);
+	errorCond(address < 0 || (uint32_t)address >= memSize, "address is out of range");
+	errorCond(length <= 0, "length must be > 0");
+
+	//Stop at the end of the memory type
+	length = (int)std::min<int64_t>(length, (int64_t)memSize - address);
+	uint32_t endAddress = (uint32_t)((int64_t)address + length - 1);
+
+	if(lua_istable(lua, 1)) {
+		//Remove values past the new length, if the table was previously filled with more values
+		int prevLength = (int)lua_rawlen(lua, 1);
+		for(int i = prevLength; i > length; i--) {
+			lua_pushnil(lua);
+			lua_rawseti(lua, 1, i);
+		}
+	} else {
+		lua_pop(lua, 1);
+		lua_createtable(lua, length, 0);
+	}
+
+	vector<uint8_t> values(length);
+	if(disableSideEffects || !DebugUtilities::IsRelativeMemory(memType)) {
+		_memoryDumper->GetMemoryValues(memType, address, endAddress, values.data());
+	} else {
+		for(int i = 0; i < length; i++) {
+			values[i] = _memoryDumper->GetMemoryValue(memType, address + i, false);
+		}
+	}
+
+	for(int i = 0; i < length; i++) {
+		lua_pushinteger(lua, values[i]);
+		lua_rawseti(lua, -2, i + 1);
+	}
+
+	return 1;
+}
+
+int LuaApi::WriteMemoryBlock(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	lua_settop(lua, 3);
+
+	//Move the table (2nd parameter) below the other parameters
+	lua_pushvalue(lua, 2);
+	lua_remove(lua, 2);
+	lua_insert(lua, 1);
+
+	int type = l.ReadInteger();
+	bool disableSideEffects = (type & 0x100) == 0x100;
+	MemoryType memType = (MemoryType)(type & 0xFF);
+	int address = l.ReadInteger();
+	checkminparams(2);
+	checkEnum(MemoryType, memType, "invalid memory type");
+	errorCond(!lua_istable(lua, 1), "values must be a table");
+
+	uint32_t memSize = _memoryDumper->GetMemorySize(memType);
+	errorCond(address < 0 || (uint32_t)address >= memSize, "address is out of range");
+
+	//Values past the end of the memory type are ignored
+	int length = (int)std::min<int64_t>(lua_rawlen(lua, 1), (int64_t)memSize - address);
+	for(int i = 0; i < length; i++) {
+		lua_rawgeti(lua, 1, i + 1);
+		uint8_t value = (uint8_t)lua_tointeger(lua, -1);
+		lua_pop(lua, 1);
+		_memoryDumper->SetMemoryValue(memType, address + i, value, disableSideEffects);
+	}
+
+	return l.ReturnCount();
+}
+
+int LuaApi::GetMemoryView(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	int type = l.ReadInteger();
+	MemoryType memType = (MemoryType)(type & 0xFF);
+	checkparams();
+	checkEnum(MemoryType, memType, "invalid memory type");
+	errorCond(DebugUtilities::IsRelativeMemory(memType) || _memoryDumper->GetMemoryBuffer(memType) == nullptr, "memory type cannot be accessed through a memory view");
+
+	LuaMemoryView* view = (LuaMemoryView*)lua_newuserdatauv(lua, sizeof(LuaMemoryView), 0);
+	view->Type = memType;
+
+	if(luaL_newmetatable(lua, MemoryViewMetatable)) {
+		lua_pushcfunction(lua, LuaApi::MemoryViewIndex);
+		lua_setfield(lua, -2, "__index");
+		lua_pushcfunction(lua, LuaApi::MemoryViewNewIndex);
+		lua_setfield(lua, -2, "__newindex");
+		lua_pushcfunction(lua, LuaApi::MemoryViewLength);
+		lua_setfield(lua, -2, "__len");
+	}
+	lua_setmetatable(lua, -2);
+	return 1;
+}
+
+int LuaApi::MemoryViewIndex(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	Nullable<int32_t> address = l.ReadOptionalInteger();
+	LuaMemoryView* view = (LuaMemoryView*)luaL_testudata(lua, -1, MemoryViewMetatable);
+	errorCond(view == nullptr, "invalid memory view");
+
+	//The view only stores the memory type, the buffer is looked up on each access
+	//to avoid keeping a dangling pointer if the memory is reallocated (e.g when loading a game)
+	uint8_t* buffer = _memoryDumper->GetMemoryBuffer(view->Type);
+	if(!buffer || !address.HasValue || address.Value < 0 || (uint32_t)address.Value >= _memoryDumper->GetMemorySize(view->Type)) {
+		lua_pushnil(lua);
+		return 1;
+	}
+
+	l.Return((int)buffer[address.Value]);
+	return l.ReturnCount();
+}
+
+int LuaApi::MemoryViewNewIndex(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	int value = l.ReadInteger();
+	Nullable<int32_t> address = l.ReadOptionalInteger();
+	LuaMemoryView* view = (LuaMemoryView*)luaL_testudata(lua, -1, MemoryViewMetatable);
+	errorCond(view == nullptr, "invalid memory view");
+	errorCond(!address.HasValue || address.Value < 0 || (uint32_t)address.Value >= _memoryDumper->GetMemorySize(view->Type), "address out of range");
+	errorCond(value > 255 || value < -128, "value out of range");
+	_memoryDumper->SetMemoryValue(view->Type, (uint32_t)address.Value, (uint8_t)value, true);
+	return l.ReturnCount();
+}
+
+int LuaApi::MemoryViewLength(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	//Lua passes the view as both parameters of the __len metamethod
+	LuaMemoryView* view = (LuaMemoryView*)luaL_testudata(lua, 1, MemoryViewMetatable);
+	errorCond(view == nullptr, "invalid memory view");
+	l.Return(_memoryDumper->GetMemorySize(view->Type));
+	return l.ReturnCount();
+}
+
 int LuaApi::GetLabelAddress(lua_State* lua)
 {
 	LuaCallHelper l(lua);
@@ -393,6 +561,16 @@ int LuaApi::GetLabelAddress(lua_State* lua)
 }
 
 int LuaApi::RegisterMemoryCallback(lua_State *lua)
+{
+	return InternalRegisterMemoryCallback(lua, false);
+}
+
+int LuaApi::RegisterBatchedMemoryCallback(lua_State *lua)
+{
+	return InternalRegisterMemoryCallback(lua, true);
+}
+
+int LuaApi::InternalRegisterMemoryCallback(lua_State *lua, bool batched)
 {
 	LuaCallHelper l(lua);
 	l.ForceParamCount(6);
@@ -417,8 +595,8 @@ int LuaApi::RegisterMemoryCallback(lua_State *lua)
 	checkEnum(CpuType, cpuType, "invalid cpu type");
 	errorCond(reference == LUA_NOREF, "callback function could not be found");
 
-	_context->RegisterMemoryCallback(callbackType, startAddr, endAddr, memType, cpuType, reference);
-	_context->Log("Registered memory callback from $" + HexUtilities::ToHex((uint32_t)startAddr) + " to $" + HexUtilities::ToHex((uint32_t)endAddr));
+	_context->RegisterMemoryCallback(callbackType, startAddr, endAddr, memType, cpuType, reference, batched);
+	_context->Log(string(batched ? "Registered batched memory callback" : "Registered memory callback") + " from $" + HexUtilities::ToHex((uint32_t)startAddr) + " to $" + HexUtilities::ToHex((uint32_t)endAddr));
 	l.Return(reference);
 	return l.ReturnCount();
 }
@@ -949,6 +1127,17 @@ int LuaApi::ResetAccessCounters(lua_State *lua)
 	return l.ReturnCount();
 }
 
+int LuaApi::GetScriptTiming(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	checkparams();
+
+	lua_newtable(lua);
+	lua_pushdoublevalue(lastFrame, _context->GetLastFrameExecutionTime());
+	lua_pushdoublevalue(total, _context->GetTotalExecutionTime());
+	return 1;
+}
+
 int LuaApi::GetScriptDataFolder(lua_State *lua)
 {
 	LuaCallHelper l(lua);
@@ -32,10 +32,15 @@ public:
     static int ReadMemory32(lua_State* lua);
     static int WriteMemory32(lua_State* lua);
 
+    static int ReadMemoryBlock(lua_State* lua);
+    static int WriteMemoryBlock(lua_State* lua);
+    static int GetMemoryView(lua_State* lua);
+
     static int GetLabelAddress(lua_State* lua);
     static int ConvertAddress(lua_State* lua);
 
     static int RegisterMemoryCallback(lua_State* lua);
+    static int RegisterBatchedMemoryCallback(lua_State* lua);
     static int UnregisterMemoryCallback(lua_State* lua);
     static int RegisterEventCallback(lua_State* lua);
     static int UnregisterEventCallback(lua_State* lua);
@@ -89,8 +94,15 @@ public:
     static int GetAccessCounters(lua_State* lua);
     static int ResetAccessCounters(lua_State* lua);
 
+    static int GetScriptTiming(lua_State* lua);
+
 private:
     static FrameInfo InternalGetScreenSize();
+    static int InternalRegisterMemoryCallback(lua_State* lua, bool batched);
+
+    static int MemoryViewIndex(lua_State* lua);
+    static int MemoryViewNewIndex(lua_State* lua);
+    static int MemoryViewLength(lua_State* lua);
 
     static Emulator* _emu;
     static Debugger* _debugger;
@@ -67,6 +67,9 @@ void MemoryDumper::SetMemoryState(MemoryType type, uint8_t* buffer, uint32_t len
     uint8_t* dst = GetMemoryBuffer(type);
     if (dst) {
         memcpy(dst, buffer, length);
+        if (type == MemoryType::GbaExtWorkRam || type == MemoryType::GbaIntWorkRam) {
+            _gbaConsole->GetMemoryManager()->InvalidateCodePages();
+        }
     }
 }
 
@@ -257,6 +260,13 @@ void MemoryDumper::SetMemoryValue(MemoryType memoryType, uint32_t address, uint8
         case MemoryType::GbaMemory: _gbaConsole->GetMemoryManager()->DebugWrite(address, value); break;
         case MemoryType::SpcDspRegisters: _spc->DebugWriteDspReg(address, value); break;
 
+        case MemoryType::GbaExtWorkRam:
+        case MemoryType::GbaIntWorkRam:
+            //Write through the memory manager, so the CPU's cached instructions for this address are invalidated
+            _gbaConsole->GetMemoryManager()->DebugWrite((memoryType == MemoryType::GbaIntWorkRam ? 0x3000000 : 0x2000000) | address, value);
+            invalidateCache();
+            break;
+
         default:
             uint8_t* src = GetMemoryBuffer(memoryType);
             if (src) {
@@ -276,6 +286,21 @@ uint8_t MemoryDumper::GetMemoryValue(MemoryType memoryType, uint32_t address, bo
     return InternalGetMemoryValue(memoryType, address, disableSideEffects);
 }
 
+void MemoryDumper::GetMemoryValues(MemoryType memoryType, uint32_t start, uint32_t end, uint8_t* output)
+{
+    uint32_t memSize = GetMemorySize(memoryType);
+    uint8_t* src = GetMemoryBuffer(memoryType);
+    if (src && !DebugUtilities::IsRelativeMemory(memoryType) && end < memSize) {
+        // Memory types backed by a buffer can be copied directly
+        memcpy(output, src + start, end - start + 1);
+        return;
+    }
+
+    for (uint32_t i = start; i <= end; i++) {
+        output[i - start] = i < memSize ? InternalGetMemoryValue(memoryType, i) : 0;
+    }
+}
+
 uint8_t MemoryDumper::InternalGetMemoryValue(MemoryType memoryType, uint32_t address, bool disableSideEffects)
 {
     switch (memoryType) {
@@ -1,10 +1,51 @@
 #include "pch.h"
 #include "Debugger/PpuTools.h"
+#include "Debugger/Debugger.h"
 #include "Debugger/CdlManager.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugBreakHelper.h"
 #include "Shared/SettingTypes.h"
 
+namespace {
+    // Spreads the 8 bits of a bitplane byte over 8 bytes (leftmost pixel in the lowest byte), which
+    // converts a full row of planar tile data to 8 chunky color indexes with one lookup + shift per plane
+    constexpr std::array<uint64_t, 256> GeneratePlanarLut()
+    {
+        std::array<uint64_t, 256> lut = {};
+        for (int i = 0; i < 256; i++) {
+            for (int x = 0; x < 8; x++) {
+                if (i & (0x80 >> x)) {
+                    lut[i] |= (uint64_t)1 << (x * 8);
+                }
+            }
+        }
+        return lut;
+    }
+
+    // Copies the tile's bytes into the cache, returns true if they differ from the cached copy
+    bool UpdateCachedTileData(uint8_t* cachedData, const uint8_t* source, uint32_t srcSize, uint32_t ramMask, uint32_t addr, uint32_t size)
+    {
+        uint32_t start = addr & ramMask;
+        if (start + size <= srcSize) {
+            if (memcmp(cachedData, source + start, size) == 0) {
+                return false;
+            }
+            memcpy(cachedData, source + start, size);
+            return true;
+        }
+
+        bool changed = false;
+        for (uint32_t i = 0; i < size; i++) {
+            uint8_t value = source[(addr + i) & ramMask];
+            changed |= cachedData[i] != value;
+            cachedData[i] = value;
+        }
+        return changed;
+    }
+}
+
+const std::array<uint64_t, 256> PpuTools::_planarLut = GeneratePlanarLut();
+
 PpuTools::PpuTools(Debugger* debugger, Emulator* emu)
     : _emu(emu)
     , _debugger(debugger)
@@ -22,26 +63,25 @@ void PpuTools::BlendColors(uint8_t output[4], uint8_t input[4])
 
 void PpuTools::GetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t* outBuffer)
 {
+    auto lock = _tileViewLock.AcquireSafe();
     switch (options.Format) {
-        case TileFormat::Bpp2:
-        case TileFormat::Bpp4:
-        case TileFormat::Bpp8:
-        case TileFormat::DirectColor:
-        case TileFormat::Mode7:
-        case TileFormat::Mode7DirectColor:
-        case TileFormat::Mode7ExtBg:
-        case TileFormat::NesBpp2:
-        case TileFormat::PceSpriteBpp4:
-        case TileFormat::PceBackgroundBpp2Cg0:
-        case TileFormat::PceBackgroundBpp2Cg1:
-        case TileFormat::PceSpriteBpp2Sp01:
-        case TileFormat::PceSpriteBpp2Sp23:
-        case TileFormat::SmsBpp4:
-        case TileFormat::SmsSgBpp1:
-        case TileFormat::GbaBpp4:
-        case TileFormat::GbaBpp8:
-            InternalGetTileView(options, source, srcSize, colors, outBuffer);
-            break;
+        case TileFormat::Bpp2: InternalGetTileView<TileFormat::Bpp2>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::Bpp4: InternalGetTileView<TileFormat::Bpp4>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::Bpp8: InternalGetTileView<TileFormat::Bpp8>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::DirectColor: InternalGetTileView<TileFormat::DirectColor>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::Mode7: InternalGetTileView<TileFormat::Mode7>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::Mode7DirectColor: InternalGetTileView<TileFormat::Mode7DirectColor>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::Mode7ExtBg: InternalGetTileView<TileFormat::Mode7ExtBg>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::NesBpp2: InternalGetTileView<TileFormat::NesBpp2>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::PceSpriteBpp4: InternalGetTileView<TileFormat::PceSpriteBpp4>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::PceSpriteBpp2Sp01: InternalGetTileView<TileFormat::PceSpriteBpp2Sp01>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::PceSpriteBpp2Sp23: InternalGetTileView<TileFormat::PceSpriteBpp2Sp23>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::PceBackgroundBpp2Cg0: InternalGetTileView<TileFormat::PceBackgroundBpp2Cg0>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::PceBackgroundBpp2Cg1: InternalGetTileView<TileFormat::PceBackgroundBpp2Cg1>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::SmsBpp4: InternalGetTileView<TileFormat::SmsBpp4>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::SmsSgBpp1: InternalGetTileView<TileFormat::SmsSgBpp1>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::GbaBpp4: InternalGetTileView<TileFormat::GbaBpp4>(options, source, srcSize, colors, outBuffer); break;
+        case TileFormat::GbaBpp8: InternalGetTileView<TileFormat::GbaBpp8>(options, source, srcSize, colors, outBuffer); break;
     }
 }
 
@@ -52,7 +92,7 @@ uint32_t PpuTools::GetBackgroundColor(TileBackground bgColor, const uint32_t* co
         case TileBackground::Default:
             return colors[0];
         case TileBackground::PaletteColor:
-            return colors[paletteIndex_*_(1_<<_bpp)];
+            return colors[paletteIndex * (1 << bpp)];
         case TileBackground::Black:
             return 0xFF000000;
         case TileBackground::White:
@@ -83,10 +123,210 @@ uint32_t PpuTools::GetSpriteBackgroundColor(SpriteBackground bgColor, const uint
     }
 }
 
+bool PpuTools::IsTileHidden(MemoryType memType, uint32_t addr, GetTileViewOptions& options)
+{
+    if (options.Filter == TileFilter::None) {
+        return false;
+    }
+
+    int16_t cdlFlags = _debugger->GetCdlManager()->GetCdlFlags(memType, addr);
+    if (cdlFlags == -1) {
+        // No CDL data available for this memory type
+        return false;
+    }
+
+    if (options.Filter == TileFilter::HideUnused) {
+        return cdlFlags == 0;
+    } else {
+        return cdlFlags != 0;
+    }
+}
+
+bool PpuTools::IsTileViewCacheValid(GetTileViewOptions& options, uint32_t bgColor, const uint32_t* palette, uint32_t paletteSize)
+{
+    TileViewCache& cache = _tileViewCache;
+    GetTileViewOptions& prev = cache.Options;
+
+    return (
+        cache.Valid &&
+        prev.MemType == options.MemType &&
+        prev.Format == options.Format &&
+        prev.Layout == options.Layout &&
+        prev.Filter == options.Filter &&
+        prev.Background == options.Background &&
+        prev.Width == options.Width &&
+        prev.Height == options.Height &&
+        prev.StartAddress == options.StartAddress &&
+        prev.Palette == options.Palette &&
+        prev.UseGrayscalePalette == options.UseGrayscalePalette &&
+        cache.BgColor == bgColor &&
+        cache.Palette.size() == paletteSize &&
+        memcmp(cache.Palette.data(), palette, paletteSize * sizeof(uint32_t)) == 0
+    );
+}
+
+template <TileFormat format>
+void PpuTools::DrawTile(const uint8_t* ram, uint32_t ramMask, uint32_t addr, int rowOffset, int tileWidth, int tileHeight, const uint32_t* colors, uint8_t palette, uint32_t bgColor, uint32_t* out, uint32_t outputWidth)
+{
+    for (int y = 0; y < tileHeight; y++) {
+        uint32_t rowStart = addr + y * rowOffset;
+        uint32_t* outRow = out + y * outputWidth;
+
+        if constexpr (IsPlanarFormat<format>()) {
+            uint64_t pixels = GetPlanarTileRow<format>(ram, ramMask, rowStart);
+            if (pixels == 0) {
+                std::fill(outRow, outRow + 8, bgColor);
+                continue;
+            }
+
+            for (int x = 0; x < 8; x++) {
+                uint8_t color = (uint8_t)(pixels >> (x * 8));
+                outRow[x] = color == 0 ? bgColor : GetRgbPixelColor<format>(colors, color, palette);
+            }
+        } else {
+            for (int x = 0; x < tileWidth; x++) {
+                uint8_t color = GetTilePixelColor<format>(ram, ramMask, rowStart, x);
+                outRow[x] = color == 0 ? bgColor : GetRgbPixelColor<format>(colors, color, palette);
+            }
+        }
+    }
+}
+
 template <TileFormat format>
 void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t* outBuffer)
 {
-    // ...
+    uint32_t ramMask = srcSize - 1;
+    uint8_t bpp;
+    int rowOffset = 2;
+    int tileWidth = 8;
+    int tileHeight = 8;
+
+    switch (format) {
+        case TileFormat::Bpp2: bpp = 2; break;
+        case TileFormat::Bpp4: bpp = 4; break;
+        case TileFormat::Bpp8: bpp = 8; break;
+        case TileFormat::DirectColor: bpp = 8; break;
+
+        case TileFormat::Mode7:
+        case TileFormat::Mode7DirectColor:
+        case TileFormat::Mode7ExtBg:
+            bpp = 16;
+            rowOffset = 16;
+            break;
+
+        case TileFormat::NesBpp2: bpp = 2; rowOffset = 1; break;
+
+        case TileFormat::PceSpriteBpp4:
+        case TileFormat::PceSpriteBpp2Sp01:
+        case TileFormat::PceSpriteBpp2Sp23:
+            bpp = 4;
+            tileWidth = 16;
+            tileHeight = 16;
+            break;
+
+        // 2bpp PCE formats use the same amount of space in RAM as the 4bpp tiles
+        case TileFormat::PceBackgroundBpp2Cg0:
+        case TileFormat::PceBackgroundBpp2Cg1:
+            bpp = 4;
+            break;
+
+        case TileFormat::SmsBpp4: bpp = 4; rowOffset = 4; break;
+        case TileFormat::SmsSgBpp1: bpp = 1; rowOffset = 1; break;
+        case TileFormat::GbaBpp4: bpp = 4; rowOffset = 4; break;
+        case TileFormat::GbaBpp8: bpp = 8; rowOffset = 8; break;
+
+        default: bpp = 8; break;
+    }
+
+    uint8_t colorBpp = std::min<uint8_t>(bpp, 8);
+    uint32_t paletteSize = 1 << colorBpp;
+
+    uint32_t grayscaleColors[256];
+    if (options.UseGrayscalePalette) {
+        options.Palette = 0;
+        switch (colorBpp) {
+            case 1: colors = _grayscaleColorsBpp1; break;
+            case 2: colors = _grayscaleColorsBpp2; break;
+            case 4: colors = _grayscaleColorsBpp4; break;
+            default:
+                for (int i = 0; i < 256; i++) {
+                    grayscaleColors[i] = 0xFF000000 | (i << 16) | (i << 8) | i;
+                }
+                colors = grayscaleColors;
+                break;
+        }
+    }
+
+    uint32_t bgColor = GetBackgroundColor(options.Background, colors, options.Palette, colorBpp);
+
+    uint32_t bytesPerTile = tileWidth * tileHeight * bpp / 8;
+    uint32_t outputWidth = options.Width * 8;
+    uint32_t outputHeight = options.Height * 8;
+    int tilesPerRow = outputWidth / tileWidth;
+    int rowCount = outputHeight / tileHeight;
+    int tileCount = tilesPerRow * rowCount;
+
+    TileViewCache& cache = _tileViewCache;
+    const uint32_t* palette = colors + options.Palette * paletteSize;
+    bool fullRefresh = !IsTileViewCacheValid(options, bgColor, palette, paletteSize);
+    if (fullRefresh) {
+        cache.Valid = true;
+        cache.Options = options;
+        cache.BgColor = bgColor;
+        cache.Palette.assign(palette, palette + paletteSize);
+        cache.Source.assign(tileCount * bytesPerTile, 0);
+        cache.Hidden.assign(tileCount, 0);
+        cache.Output.assign(outputWidth * outputHeight, bgColor);
+    }
+
+    for (int index = 0; index < tileCount; index++) {
+        uint32_t addr = options.StartAddress + index * bytesPerTile;
+        bool changed = UpdateCachedTileData(cache.Source.data() + index * bytesPerTile, source, srcSize, ramMask, addr, bytesPerTile);
+        bool hidden = IsTileHidden(options.MemType, addr & ramMask, options);
+        if (!fullRefresh && !changed && hidden == (bool)cache.Hidden[index]) {
+            // Tile is identical to the previous call, keep the cached pixels
+            continue;
+        }
+        cache.Hidden[index] = hidden;
+
+        int column = index % tilesPerRow;
+        int row = index / tilesPerRow;
+        switch (options.Layout) {
+            case TileLayout::SingleLine8x16: {
+                int displayColumn = column / 2 + ((row & 0x01) ? options.Width / 2 : 0);
+                int displayRow = (row & ~0x01) + ((column & 0x01) ? 1 : 0);
+                column = displayColumn;
+                row = displayRow;
+                break;
+            }
+
+            case TileLayout::SingleLine16x16: {
+                int displayColumn = (column / 2) + (column & 0x01) + ((row & 0x01) ? options.Width / 2 : 0) + ((column & 0x02) ? -1 : 0);
+                int displayRow = (row & ~0x01) + ((column & 0x02) ? 1 : 0);
+                column = displayColumn;
+                row = displayRow;
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        if (column < 0 || column >= tilesPerRow || row >= rowCount) {
+            continue;
+        }
+
+        uint32_t* out = cache.Output.data() + row * tileHeight * outputWidth + column * tileWidth;
+        if (hidden) {
+            for (int y = 0; y < tileHeight; y++) {
+                std::fill(out + y * outputWidth, out + y * outputWidth + tileWidth, bgColor);
+            }
+        } else {
+            DrawTile<format>(source, ramMask, addr, rowOffset, tileWidth, tileHeight, colors, options.Palette, bgColor, out, outputWidth);
+        }
+    }
+
+    memcpy(outBuffer, cache.Output.data(), cache.Output.size() * sizeof(uint32_t));
 }
 
 void PpuTools::SetViewerUpdateTiming(uint32_t viewerId, uint16_t scanline, uint16_t cycle)
@@ -4,6 +4,8 @@
 #include "Shared/NotificationManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/ColorUtilities.h"
+#include "Utilities/SimpleLock.h"
+#include <array>
 
 class Debugger;
 
@@ -65,7 +67,7 @@ struct DebugSpriteInfo {
     NullableBoolean UseSecondTable;
 
     uint32_t TileCount;
-    uint32_t TileAddresses[8_*_8];
+    uint32_t TileAddresses[8 * 8];
 
     void Init() {
         TileIndex = -1;
@@ -200,16 +202,65 @@ protected:
         0xFF989898, 0xFFA0A0A0, 0xFFAAAAAA, 0xFFBBBBBB, 0xFFCCCCCC, 0xFFDDDDDD, 0xFFEEEEEE, 0xFFFFFFFF
     };
 
+    // Result of the previous GetTileView call - only the tiles whose source bytes
+    // (or CDL-based visibility) changed since then are decoded again
+    struct TileViewCache {
+        bool Valid = false;
+        GetTileViewOptions Options = {};
+        uint32_t BgColor = 0;
+        vector<uint32_t> Palette;
+        vector<uint8_t> Source;
+        vector<uint8_t> Hidden;
+        vector<uint32_t> Output;
+    };
+
     Emulator* _emu;
     Debugger* _debugger;
     unordered_map<uint32_t, ViewerRefreshConfig> _updateTimings;
 
+    TileViewCache _tileViewCache;
+    SimpleLock _tileViewLock;
+
     void BlendColors(uint8_t output[4], uint8_t input[4]);
 
+    // Each byte spreads the bits of a bitplane byte over 8 bytes (leftmost pixel in the lowest byte)
+    static const std::array<uint64_t, 256> _planarLut;
+
     template<TileFormat format> __forceinline uint32_t GetRgbPixelColor(const uint32_t* colors, uint8_t colorIndex, uint8_t palette);
-    template<TileFormat format> __forceinline uint8_t GetTilePixelColor(const uint8_t* ram, const uint32_t ramMask, uint32_t rowStart, uint8_t pixelIndex);
+    template<TileFormat format> __forceinline static uint8_t GetTilePixelColor(const uint8_t* ram, const uint32_t ramMask, uint32_t rowStart, uint8_t pixelIndex);
+
+    template<TileFormat format> static constexpr bool IsPlanarFormat();
+    template<TileFormat format> __forceinline static uint64_t GetPlanarTileRow(const uint8_t* ram, uint32_t ramMask, uint32_t rowStart);
+
+    // Drop-in replacement for GetTilePixelColor in loops that draw a tile row pixel by pixel:
+    // planar rows are converted to 8 color indexes at once, and reused until another row is requested
+    // (the source RAM must not change while the decoder is in use)
+    template<TileFormat format>
+    class TileRowDecoder {
+    private:
+        uint64_t _pixels = 0;
+        uint32_t _rowStart = UINT32_MAX;
+
+    public:
+        __forceinline uint8_t GetPixelColor(const uint8_t* ram, uint32_t ramMask, uint32_t rowStart, uint8_t pixelIndex)
+        {
+            if constexpr (IsPlanarFormat<format>()) {
+                if (rowStart != _rowStart) {
+                    _pixels = GetPlanarTileRow<format>(ram, ramMask, rowStart);
+                    _rowStart = rowStart;
+                }
+                return (uint8_t)(_pixels >> (pixelIndex * 8));
+            } else {
+                return GetTilePixelColor<format>(ram, ramMask, rowStart, pixelIndex);
+            }
+        }
+    };
 
     bool IsTileHidden(MemoryType memType, uint32_t addr, GetTileViewOptions& options);
+    bool IsTileViewCacheValid(GetTileViewOptions& options, uint32_t bgColor, const uint32_t* palette, uint32_t paletteSize);
+
+    template<TileFormat format>
+    void DrawTile(const uint8_t* ram, uint32_t ramMask, uint32_t addr, int rowOffset, int tileWidth, int tileHeight, const uint32_t* colors, uint8_t palette, uint32_t bgColor, uint32_t* out, uint32_t outputWidth);
 
     uint32_t GetBackgroundColor(TileBackground bgColor, const uint32_t* colors, uint8_t paletteIndex = 0, uint8_t bpp = 0);
     uint32_t GetSpriteBackgroundColor(SpriteBackground bgColor, const uint32_t* colors, bool useDarkerColor);
@@ -263,7 +314,7 @@ uint32_t PpuTools::GetRgbPixelColor(const uint32_t* colors, uint8_t colorIndex,
 
         case TileFormat::NesBpp2:
         case TileFormat::Bpp2:
-            return colors[palette_*_4_+_colorIndex];
+            return colors[palette * 4 + colorIndex];
 
         case TileFormat::Bpp4:
         case TileFormat::SmsBpp4:
@@ -273,25 +324,65 @@ uint32_t PpuTools::GetRgbPixelColor(const uint32_t* colors, uint8_t colorIndex,
         case TileFormat::PceSpriteBpp2Sp23:
         case TileFormat::PceBackgroundBpp2Cg0:
         case TileFormat::PceBackgroundBpp2Cg1:
-            return colors[palette_*_16_+_colorIndex];
+            return colors[palette * 16 + colorIndex];
 
         case TileFormat::Bpp8:
         case TileFormat::GbaBpp8:
         case TileFormat::Mode7:
         case TileFormat::Mode7ExtBg:
-            return colors[palette_*_256_+_colorIndex];
+            return colors[palette * 256 + colorIndex];
 
         case TileFormat::Mode7DirectColor:
             return ColorUtilities::Rgb555ToArgb(((colorIndex & 0x07) << 2) | ((colorIndex & 0x38) << 4) | ((colorIndex & 0xC0) << 7));
 
         case TileFormat::SmsSgBpp1:
-            return colors[palette_*_2_+_colorIndex];
+            return colors[palette * 2 + colorIndex];
 
         default:
             throw std::runtime_error("unsupported format");
     }
 }
 
+template<TileFormat format>
+constexpr bool PpuTools::IsPlanarFormat()
+{
+    switch (format) {
+        case TileFormat::Bpp2:
+        case TileFormat::Bpp4:
+        case TileFormat::Bpp8:
+        case TileFormat::DirectColor:
+        case TileFormat::NesBpp2:
+        case TileFormat::PceBackgroundBpp2Cg0:
+        case TileFormat::PceBackgroundBpp2Cg1:
+        case TileFormat::SmsBpp4:
+        case TileFormat::SmsSgBpp1:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+template<TileFormat format>
+uint64_t PpuTools::GetPlanarTileRow(const uint8_t* ram, uint32_t ramMask, uint32_t rowStart)
+{
+    auto plane = [=](uint32_t offset, uint8_t bit) { return _planarLut[ram[(rowStart + offset) & ramMask]] << bit; };
+
+    switch (format) {
+        case TileFormat::Bpp2: return plane(0, 0) | plane(1, 1);
+        case TileFormat::NesBpp2: return plane(0, 0) | plane(8, 1);
+        case TileFormat::Bpp4: return plane(0, 0) | plane(1, 1) | plane(16, 2) | plane(17, 3);
+        case TileFormat::Bpp8:
+        case TileFormat::DirectColor:
+            return plane(0, 0) | plane(1, 1) | plane(16, 2) | plane(17, 3) | plane(32, 4) | plane(33, 5) | plane(48, 6) | plane(49, 7);
+        case TileFormat::PceBackgroundBpp2Cg0: return plane(0, 0) | plane(1, 1);
+        case TileFormat::PceBackgroundBpp2Cg1: return plane(16, 0) | plane(17, 1);
+        case TileFormat::SmsBpp4: return plane(0, 0) | plane(1, 1) | plane(2, 2) | plane(3, 3);
+        case TileFormat::SmsSgBpp1: return plane(0, 0);
+        default: return 0;
+    }
+}
+
 template<TileFormat format>
 uint8_t PpuTools::GetTilePixelColor(const uint8_t* ram, const uint32_t ramMask, uint32_t rowStart, uint8_t pixelIndex)
 {
@@ -314,77 +405,77 @@ uint8_t PpuTools::GetTilePixelColor(const uint8_t* ram, const uint32_t ramMask,
 
     switch (format) {
         case TileFormat::PceSpriteBpp4:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_32)_&_ramMask] >> shift) & 0x01) << 1;
-            color |= (((ram[(rowStart_+_64)_&_ramMask] >> shift) & 0x01) << 2;
-            color |= (((ram[(rowStart_+_96)_&_ramMask] >> shift) & 0x01) << 3;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 32) & ramMask] >> shift) & 0x01) << 1;
+            color |= ((ram[(rowStart + 64) & ramMask] >> shift) & 0x01) << 2;
+            color |= ((ram[(rowStart + 96) & ramMask] >> shift) & 0x01) << 3;
             return color;
 
         case TileFormat::PceSpriteBpp2Sp01:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_32)_&_ramMask] >> shift) & 0x01) << 1;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 32) & ramMask] >> shift) & 0x01) << 1;
             return color;
 
         case TileFormat::PceSpriteBpp2Sp23:
-            color = (((ram[(rowStart_+_64)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_96)_&_ramMask] >> shift) & 0x01) << 1;
+            color = ((ram[(rowStart + 64) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 96) & ramMask] >> shift) & 0x01) << 1;
             return color;
 
         case TileFormat::PceBackgroundBpp2Cg0:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_1)_&_ramMask] >> shift) & 0x01) << 1;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 1) & ramMask] >> shift) & 0x01) << 1;
             return color;
 
         case TileFormat::PceBackgroundBpp2Cg1:
-            color = (((ram[(rowStart_+_16)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_17)_&_ramMask] >> shift) & 0x01) << 1;
+            color = ((ram[(rowStart + 16) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 17) & ramMask] >> shift) & 0x01) << 1;
             return color;
 
         case TileFormat::Bpp2:
-            color = (((ram[rowStart_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_1)_&_ramMask] >> shift) & 0x01) << 1;
+            color = ((ram[rowStart & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 1) & ramMask] >> shift) & 0x01) << 1;
             return color;
 
         case TileFormat::NesBpp2:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_8)_&_ramMask] >> shift) & 0x01) << 1;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 8) & ramMask] >> shift) & 0x01) << 1;
             return color;
 
         case TileFormat::Bpp4:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_1)_&_ramMask] >> shift) & 0x01) << 1;
-            color |= (((ram[(rowStart_+_16)_&_ramMask] >> shift) & 0x01) << 2;
-            color |= (((ram[(rowStart_+_17)_&_ramMask] >> shift) & 0x01) << 3;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 1) & ramMask] >> shift) & 0x01) << 1;
+            color |= ((ram[(rowStart + 16) & ramMask] >> shift) & 0x01) << 2;
+            color |= ((ram[(rowStart + 17) & ramMask] >> shift) & 0x01) << 3;
             return color;
 
         case TileFormat::Bpp8:
         case TileFormat::DirectColor:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_1)_&_ramMask] >> shift) & 0x01) << 1;
-            color |= (((ram[(rowStart_+_16)_&_ramMask] >> shift) & 0x01) << 2;
-            color |= (((ram[(rowStart_+_17)_&_ramMask] >> shift) & 0x01) << 3;
-            color |= (((ram[(rowStart_+_32)_&_ramMask] >> shift) & 0x01) << 4;
-            color |= (((ram[(rowStart_+_33)_&_ramMask] >> shift) & 0x01) << 5;
-            color |= (((ram[(rowStart_+_48)_&_ramMask] >> shift) & 0x01) << 6;
-            color |= (((ram[(rowStart_+_49)_&_ramMask] >> shift) & 0x01) << 7;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 1) & ramMask] >> shift) & 0x01) << 1;
+            color |= ((ram[(rowStart + 16) & ramMask] >> shift) & 0x01) << 2;
+            color |= ((ram[(rowStart + 17) & ramMask] >> shift) & 0x01) << 3;
+            color |= ((ram[(rowStart + 32) & ramMask] >> shift) & 0x01) << 4;
+            color |= ((ram[(rowStart + 33) & ramMask] >> shift) & 0x01) << 5;
+            color |= ((ram[(rowStart + 48) & ramMask] >> shift) & 0x01) << 6;
+            color |= ((ram[(rowStart + 49) & ramMask] >> shift) & 0x01) << 7;
             return color;
 
         case TileFormat::Mode7:
         case TileFormat::Mode7DirectColor:
-            return ram[(rowStart_+_pixelIndex_*_2_+_1)_&_ramMask];
+            return ram[(rowStart + pixelIndex * 2 + 1) & ramMask];
 
         case TileFormat::Mode7ExtBg:
-            return ram[(rowStart_+_pixelIndex_*_2_+_1)_&_ramMask] & 0x7F;
+            return ram[(rowStart + pixelIndex * 2 + 1) & ramMask] & 0x7F;
 
         case TileFormat::SmsBpp4:
-            color = (((ram[(rowStart_+_0)_&_ramMask] >> shift) & 0x01) << 0;
-            color |= (((ram[(rowStart_+_1)_&_ramMask] >> shift) & 0x01) << 1;
-            color |= (((ram[(rowStart_+_2)_&_ramMask] >> shift) & 0x01) << 2;
-            color |= (((ram[(rowStart_+_3)_&_ramMask] >> shift) & 0x01) << 3;
+            color = ((ram[(rowStart + 0) & ramMask] >> shift) & 0x01) << 0;
+            color |= ((ram[(rowStart + 1) & ramMask] >> shift) & 0x01) << 1;
+            color |= ((ram[(rowStart + 2) & ramMask] >> shift) & 0x01) << 2;
+            color |= ((ram[(rowStart + 3) & ramMask] >> shift) & 0x01) << 3;
             return color;
 
         case TileFormat::SmsSgBpp1:
-            color = ((ram[rowStart_&_ramMask] >> shift) & 0x01);
+            color = ((ram[rowStart & ramMask] >> shift) & 0x01);
             return color;
 
         case TileFormat::GbaBpp4: {
@@ -53,7 +53,7 @@ void Profiler::UpdateCycles() {
 
     for (auto it = _functionStack.rbegin(); it != _functionStack.rend(); ++it) {
         _functions[*it].InclusiveCycles += clockGap;
-        if (_stackFlags[_functionStack.size()_-_1_-_std::distance(_functionStack.begin(),_it)] != StackFrameFlags::None) {
+        if (_stackFlags[_functionStack.size() - 1 - std::distance(_functionStack.rbegin(), it)] != StackFrameFlags::None) {
             break;
         }
     }
@@ -111,3 +111,6 @@ void Profiler::GetProfilerData(ProfiledFunction* profilerData, uint32_t& functio
 
         if (functionCount >= 100000) {
             break;
+        }
+    }
+}
@@ -0,0 +1,188 @@
+#include "pch.h"
+#include "Debugger/SamplingProfiler.h"
+#include "Debugger/Debugger.h"
+#include "Debugger/DebugBreakHelper.h"
+#include "Debugger/LabelManager.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Utilities/HexUtilities.h"
+
+SamplingProfiler::SamplingProfiler(Debugger* debugger, IConsole* console)
+{
+	_debugger = debugger;
+	_console = console;
+	_stopFlag = false;
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+	StopThread();
+}
+
+void SamplingProfiler::SetOptions(bool enabled, uint32_t interval)
+{
+	//Called by CallstackManager::SetSamplingOptions, which already holds the debugger break
+	_interval = std::max<uint32_t>(interval, 1);
+	_nextSampleClock = _console->GetMasterClock() + _interval;
+
+	if(enabled != _enabled) {
+		_enabled = enabled;
+		if(_enabled) {
+			StartThread();
+		} else {
+			StopThread();
+		}
+	}
+}
+
+void SamplingProfiler::StartThread()
+{
+	if(!_aggregateThread) {
+		_buffer.reserve(BufferSize);
+		_pendingBuffer.reserve(BufferSize);
+		_stopFlag = false;
+		_bufferReady.Reset();
+		_aggregateThread.reset(new thread(&SamplingProfiler::AggregateThread, this));
+	}
+}
+
+void SamplingProfiler::StopThread()
+{
+	_stopFlag = true;
+	if(_aggregateThread) {
+		_bufferReady.Signal();
+		_aggregateThread->join();
+		_aggregateThread.reset();
+	}
+
+	//Keep the samples that were recorded before sampling was disabled
+	FlushBuffer();
+}
+
+void SamplingProfiler::AggregateThread()
+{
+	vector<uint64_t> samples;
+	samples.reserve(BufferSize);
+
+	while(!_stopFlag.load()) {
+		_bufferReady.Wait();
+
+		{
+			auto lock = _bufferLock.AcquireSafe();
+			if(!_pendingReady) {
+				continue;
+			}
+			std::swap(samples, _pendingBuffer);
+			_pendingReady = false;
+		}
+
+		Aggregate(samples);
+		samples.clear();
+	}
+}
+
+void SamplingProfiler::Aggregate(vector<uint64_t>& buffer)
+{
+	auto lock = _stackLock.AcquireSafe();
+
+	vector<uint64_t> stack;
+	size_t pos = 0;
+	while(pos < buffer.size()) {
+		uint32_t frameCount = (uint32_t)buffer[pos++];
+		stack.assign(buffer.begin() + pos, buffer.begin() + pos + frameCount);
+		pos += frameCount;
+
+		_stacks[stack]++;
+	}
+}
+
+void SamplingProfiler::FlushBuffer()
+{
+	auto lock = _bufferLock.AcquireSafe();
+	if(_pendingReady) {
+		Aggregate(_pendingBuffer);
+		_pendingBuffer.clear();
+		_pendingReady = false;
+	}
+	Aggregate(_buffer);
+	_buffer.clear();
+}
+
+uint64_t* SamplingProfiler::ReserveSample(uint32_t frameCount)
+{
+	if(_buffer.size() + frameCount + 1 > BufferSize) {
+		//Hand the full buffer over to the aggregation thread - if it hasn't
+		//finished processing the previous one yet, drop the sample instead of blocking
+		auto lock = _bufferLock.AcquireSafe();
+		if(_pendingReady) {
+			return nullptr;
+		}
+
+		std::swap(_buffer, _pendingBuffer);
+		_pendingReady = true;
+		_bufferReady.Signal();
+	}
+
+	size_t pos = _buffer.size();
+	_buffer.resize(pos + frameCount + 1);
+	_buffer[pos] = frameCount;
+	return _buffer.data() + pos + 1;
+}
+
+string SamplingProfiler::GetFunctionName(uint64_t key)
+{
+	AddressInfo addr = { (int32_t)(uint32_t)key, (MemoryType)(key >> 32) };
+	if(addr.Address < 0) {
+		return "[Unknown]";
+	}
+
+	string label = _debugger->GetLabelManager()->GetLabel(addr);
+	if(label.empty()) {
+		return "$" + HexUtilities::ToHex24(addr.Address);
+	}
+	return label;
+}
+
+void SamplingProfiler::Reset()
+{
+	DebugBreakHelper helper(_debugger);
+
+	{
+		auto lock = _bufferLock.AcquireSafe();
+		_buffer.clear();
+		_pendingBuffer.clear();
+		_pendingReady = false;
+	}
+
+	auto lock = _stackLock.AcquireSafe();
+	_stacks.clear();
+	_nextSampleClock = _console->GetMasterClock() + _interval;
+}
+
+bool SamplingProfiler::SaveFoldedStacks(string filename)
+{
+	DebugBreakHelper helper(_debugger);
+	FlushBuffer();
+
+	ofstream out(filename, ios::out | ios::binary);
+	if(!out) {
+		return false;
+	}
+
+	//Output uses the "folded stacks" format expected by flamegraph tools:
+	//one line per unique callstack, frames separated by ';', followed by the sample count
+	auto lock = _stackLock.AcquireSafe();
+	unordered_map<uint64_t, string> names;
+	for(auto& [stack, count] : _stacks) {
+		out << "[Reset]";
+		for(uint64_t key : stack) {
+			auto result = names.find(key);
+			if(result == names.end()) {
+				result = names.emplace(key, GetFunctionName(key)).first;
+			}
+			out << ";" << result->second;
+		}
+		out << " " << count << "\n";
+	}
+
+	return true;
+}
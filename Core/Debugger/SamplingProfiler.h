@@ -0,0 +1,89 @@
+#pragma once
+#include "pch.h"
+#include <map>
+#include "Debugger/DebugTypes.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+
+class Debugger;
+
+//Statistical alternative to the exact Profiler: instead of updating per-function
+//counters on every call/return, the current callstack is recorded every N master clocks
+//into a flat buffer which is aggregated on a background thread.
+class SamplingProfiler
+{
+private:
+	static constexpr uint32_t BufferSize = 0x20000;
+	static constexpr uint32_t MaxSampleDepth = 128;
+
+	Debugger* _debugger = nullptr;
+	IConsole* _console = nullptr;
+
+	bool _enabled = false;
+	uint32_t _interval = 1000;
+	uint64_t _nextSampleClock = 0;
+
+	//Each sample is stored as [frame count, frame 0, ..., frame N-1]
+	//Frames are function entry points (outermost first), encoded by GetFunctionKey
+	vector<uint64_t> _buffer;
+	vector<uint64_t> _pendingBuffer;
+	bool _pendingReady = false;
+	SimpleLock _bufferLock;
+
+	std::map<vector<uint64_t>, uint64_t> _stacks;
+	SimpleLock _stackLock;
+
+	unique_ptr<thread> _aggregateThread;
+	AutoResetEvent _bufferReady;
+	atomic<bool> _stopFlag;
+
+	void AggregateThread();
+	void Aggregate(vector<uint64_t>& buffer);
+	void FlushBuffer();
+	void StartThread();
+	void StopThread();
+
+	uint64_t* ReserveSample(uint32_t frameCount);
+
+	//The memory type is kept separate from the address, some address spaces (e.g GBA) use more than 24 bits
+	static uint64_t GetFunctionKey(AddressInfo& addr) { return ((uint64_t)addr.Type << 32) | (uint32_t)addr.Address; }
+	string GetFunctionName(uint64_t key);
+
+public:
+	SamplingProfiler(Debugger* debugger, IConsole* console);
+	~SamplingProfiler();
+
+	void SetOptions(bool enabled, uint32_t interval);
+	bool IsEnabled() { return _enabled; }
+
+	__forceinline bool IsSampleDue()
+	{
+		uint64_t masterClock = _console->GetMasterClock();
+		if(masterClock < _nextSampleClock) {
+			return false;
+		}
+
+		_nextSampleClock = masterClock + _interval;
+		return true;
+	}
+
+	//Must only be called when IsSampleDue() returns true
+	template<typename T>
+	void RecordSample(uint32_t callstackSize, T getFrame)
+	{
+		//Keep the innermost frames when the callstack is deeper than the max sample depth
+		uint32_t frameCount = std::min(callstackSize, MaxSampleDepth);
+		uint64_t* sample = ReserveSample(frameCount);
+		if(!sample) {
+			return;
+		}
+
+		for(uint32_t i = callstackSize - frameCount; i < callstackSize; i++) {
+			*(sample++) = GetFunctionKey(getFrame(i).AbsTarget);
+		}
+	}
+
+	void Reset();
+	bool SaveFoldedStacks(string filename);
+};
@@ -31,6 +31,7 @@ int ScriptManager::LoadScript(string name, string path, string content, int32_t
 		scriptId = script->GetScriptId();
 		_scripts.push_back(std::move(script));
 		_hasScript = true;
+		//The new script's callbacks were added to the filters as they were registered, no need to rebuild them
 		return scriptId;
 	} else {
 		auto result = std::find_if(_scripts.begin(), _scripts.end(), [=](unique_ptr<ScriptHost> &script) {
@@ -73,11 +74,69 @@ void ScriptManager::RefreshMemoryCallbackFlags()
 {
 	_isPpuMemoryCallbackEnabled = false;
 	_isCpuMemoryCallbackEnabled = false;
+	for(auto& cpuFilters : _callbackFilters) {
+		for(MemoryCallbackFilter& filter : cpuFilters) {
+			filter.Clear();
+		}
+	}
+
 	for(unique_ptr<ScriptHost>& script : _scripts) {
 		script->RefreshMemoryCallbackFlags();
 	}
 }
 
+void ScriptManager::AddMemoryCallbackFilter(CallbackType type, CpuType cpuType, MemoryType memType, uint32_t start, uint32_t end)
+{
+	MemoryCallbackFilter& filter = _callbackFilters[(int)cpuType][(int)type];
+	if(DebugUtilities::IsRelativeMemory(memType)) {
+		filter.AddRange(start, end);
+	} else {
+		//Callbacks on absolute addresses can't be filtered based on the CPU's relative address
+		filter.MatchAll = true;
+	}
+}
+
+void MemoryCallbackFilter::AddRange(uint32_t start, uint32_t end)
+{
+	if(MatchAll) {
+		return;
+	}
+
+	uint32_t startPage = start >> PageShift;
+	uint32_t endPage = end >> PageShift;
+	if(endPage - startPage + 1 >= MatchAllPageCount || endPage >= MaxPageCount) {
+		MatchAll = true;
+		Pages.clear();
+		PageCount = 0;
+		return;
+	}
+
+	if(endPage >= PageCount) {
+		PageCount = endPage + 1;
+		Pages.resize((PageCount + 63) / 64);
+	}
+
+	//Set the pages 64 at a time
+	uint32_t startWord = startPage >> 6;
+	uint32_t endWord = endPage >> 6;
+	uint64_t startMask = ~(uint64_t)0 << (startPage & 0x3F);
+	uint64_t endMask = ~(uint64_t)0 >> (63 - (endPage & 0x3F));
+	if(startWord == endWord) {
+		Pages[startWord] |= startMask & endMask;
+	} else {
+		Pages[startWord] |= startMask;
+		std::fill(Pages.begin() + startWord + 1, Pages.begin() + endWord, ~(uint64_t)0);
+		Pages[endWord] |= endMask;
+	}
+}
+
+void MemoryCallbackFilter::Clear()
+{
+	Pages.clear();
+	PageCount = 0;
+	MatchAll = false;
+}
+
 string ScriptManager::GetScriptLog(int32_t scriptId)
 {
 	auto lock = _scriptLock.AcquireSafe();
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Debugger/DebugTypes.h"
+#include "Debugger/DebugUtilities.h"
 #include "Debugger/ScriptHost.h"
 #include "Utilities/SimpleLock.h"
 #include "Shared/EventType.h"
@@ -8,6 +9,30 @@
 class Debugger;
 enum class MemoryOperationType;
 
+//Bitmap of the (relative) address pages covered by at least one memory callback,
+//used to skip the scripts entirely for accesses no callback can match
+struct MemoryCallbackFilter
+{
+	static constexpr uint32_t PageShift = 8;
+	//Ranges covering this many pages or more (1MB+), or ending past MaxPageCount (256MB), match all addresses
+	//instead of filling a large bitmap - accesses in such large ranges would rarely be filtered out anyway
+	static constexpr uint32_t MatchAllPageCount = 0x1000;
+	static constexpr uint32_t MaxPageCount = 0x100000;
+
+	vector<uint64_t> Pages;
+	uint32_t PageCount = 0;
+	bool MatchAll = false;
+
+	__forceinline bool IsMatch(uint32_t addr)
+	{
+		uint32_t page = addr >> PageShift;
+		return MatchAll || (page < PageCount && (Pages[page >> 6] >> (page & 0x3F)) & 0x01);
+	}
+
+	void AddRange(uint32_t start, uint32_t end);
+	void Clear();
+};
+
 class ScriptManager
 {
 private:
@@ -18,8 +43,7 @@ private:
 	bool _isCpuMemoryCallbackEnabled = false;
 	bool _isPpuMemoryCallbackEnabled = false;
 	vector<unique_ptr<ScriptHost>> _scripts;
-	
-	void RefreshMemoryCallbackFlags();
+	MemoryCallbackFilter _callbackFilters[(int)DebugUtilities::GetLastCpuType() + 1][3];
 
 public:
 	ScriptManager(Debugger *debugger);
@@ -36,6 +60,9 @@ public:
 
 	void EnablePpuMemoryCallbacks() { _isPpuMemoryCallbackEnabled = true; }
 	bool HasPpuMemoryCallbacks() { return _scripts.size() && _isPpuMemoryCallbackEnabled; }
+
+	void AddMemoryCallbackFilter(CallbackType type, CpuType cpuType, MemoryType memType, uint32_t start, uint32_t end);
+	void RefreshMemoryCallbackFlags();
 	
 	template<typename T>
 	__forceinline void ProcessMemoryOperation(AddressInfo relAddr, T& value, MemoryOperationType type, CpuType cpuType, bool processExec)
@@ -45,22 +72,26 @@ public:
 			case MemoryOperationType::DmaRead:
 			case MemoryOperationType::PpuRenderingRead:
 			case MemoryOperationType::DummyRead:
-				for(unique_ptr<ScriptHost>& script : _scripts) {
-					script->CallMemoryCallback(relAddr, value, CallbackType::Read, cpuType);
+				if(_callbackFilters[(int)cpuType][(int)CallbackType::Read].IsMatch(relAddr.Address)) {
+					for(unique_ptr<ScriptHost>& script : _scripts) {
+						script->CallMemoryCallback(relAddr, value, CallbackType::Read, cpuType);
+					}
 				}
 				break;
 
 			case MemoryOperationType::Write:
 			case MemoryOperationType::DummyWrite:
 			case MemoryOperationType::DmaWrite:
-				for(unique_ptr<ScriptHost>& script : _scripts) {
-					script->CallMemoryCallback(relAddr, value, CallbackType::Write, cpuType);
+				if(_callbackFilters[(int)cpuType][(int)CallbackType::Write].IsMatch(relAddr.Address)) {
+					for(unique_ptr<ScriptHost>& script : _scripts) {
+						script->CallMemoryCallback(relAddr, value, CallbackType::Write, cpuType);
+					}
 				}
 				break;
 
 			case MemoryOperationType::ExecOpCode:
 			case MemoryOperationType::ExecOperand:
-				if(processExec) {
+				if(processExec && _callbackFilters[(int)cpuType][(int)CallbackType::Exec].IsMatch(relAddr.Address)) {
 					for(unique_ptr<ScriptHost>& script : _scripts) {
 						script->CallMemoryCallback(relAddr, value, CallbackType::Exec, cpuType);
 					}
@@ -195,7 +195,7 @@ bool ScriptingContext::IsSaveStateAllowed()
 	return _allowSaveState;
 }
 
-void ScriptingContext::RegisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference)
+void ScriptingContext::RegisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference, bool batched)
 {
 	if(endAddr < startAddr) {
 		return;
@@ -207,12 +207,15 @@ void ScriptingContext::RegisterMemoryCallback(CallbackType type, int startAddr,
 	callback.Reference = reference;
 	callback.Cpu = cpuType;
 	callback.MemType = memType;
+	callback.Batched = batched;
 
+	ScriptManager* scriptManager = _debugger->GetScriptManager();
 	if(DebugUtilities::IsPpuMemory(memType)) {
-		_debugger->GetScriptManager()->EnablePpuMemoryCallbacks();
+		scriptManager->EnablePpuMemoryCallbacks();
 	} else {
-		_debugger->GetScriptManager()->EnableCpuMemoryCallbacks();
+		scriptManager->EnableCpuMemoryCallbacks();
 	}
+	scriptManager->AddMemoryCallbackFilter(type, cpuType, memType, callback.StartAddress, callback.EndAddress);
 
 	_callbacks[(int)type].push_back(callback);
 }
@@ -221,11 +224,13 @@ void ScriptingContext::RefreshMemoryCallbackFlags()
 {
 	for(int i = (int)CallbackType::Read; i <= (int)CallbackType::Exec; i++) {
 		for(size_t j = 0, len = _callbacks[i].size(); j < len; j++) {
-			if(DebugUtilities::IsPpuMemory(_callbacks[i][j].MemType)) {
+			MemoryCallback& callback = _callbacks[i][j];
+			if(DebugUtilities::IsPpuMemory(callback.MemType)) {
 				_debugger->GetScriptManager()->EnablePpuMemoryCallbacks();
 			} else {
 				_debugger->GetScriptManager()->EnableCpuMemoryCallbacks();
 			}
+			_debugger->GetScriptManager()->AddMemoryCallbackFilter((CallbackType)i, callback.Cpu, callback.MemType, callback.StartAddress, callback.EndAddress);
 		}
 	}
 }
@@ -236,23 +241,32 @@ void ScriptingContext::UnregisterMemoryCallback(CallbackType type, int startAddr
 		return;
 	}
 
-	for(size_t i = 0; i < _callbacks[(int)type].size(); i++) {
-		MemoryCallback &callback = _callbacks[(int)type][i];
-		bool isMatch = (
+	vector<MemoryCallback>& callbacks = _callbacks[(int)type];
+	auto isMatch = [=](MemoryCallback& callback) {
+		return (
 			callback.Reference == reference &&
 			callback.Cpu == cpuType &&
 			callback.MemType == memType &&
 			(int)callback.StartAddress == startAddr &&
 			(int)callback.EndAddress == endAddr
 		);
+	};
 
-		if(isMatch) {
-			_callbacks[(int)type].erase(_callbacks[(int)type].begin() + i);
-			break;
-		}
+	auto result = std::find_if(callbacks.begin(), callbacks.end(), isMatch);
+	if(result != callbacks.end() && result->Batched) {
+		//Deliver any accesses that were queued before the callback was removed
+		//This calls the script, which can add or remove callbacks, so the callback needs to be found again afterwards
+		CallBatchedMemoryCallback(*result);
+		result = std::find_if(callbacks.begin(), callbacks.end(), isMatch);
 	}
 
-	luaL_unref(_lua, LUA_REGISTRYINDEX, reference);
+	if(result != callbacks.end()) {
+		callbacks.erase(result);
+		//Only release the reference here if the callback was not already removed by the script during the flush above
+		luaL_unref(_lua, LUA_REGISTRYINDEX, reference);
+	}
+
+	_debugger->GetScriptManager()->RefreshMemoryCallbackFlags();
 }
 
 void ScriptingContext::RegisterEventCallback(EventType type, int reference)
@@ -298,11 +312,23 @@ void ScriptingContext::InternalCallMemoryCallback(AddressInfo relAddr, T& value,
 			}
 		}
 
+		if(callback.Batched) {
+			callback.PendingAccesses.push_back({ (uint32_t)relAddr.Address, (uint32_t)value });
+			if(callback.PendingAccesses.size() < MaxBatchSize) {
+				continue;
+			}
+		}
+
 		if(needTimerReset) {
 			_timer.Reset();
 			needTimerReset = false;
 		}
 
+		if(callback.Batched) {
+			CallBatchedMemoryCallback(callback);
+			continue;
+		}
+
 		int top = lua_gettop(_lua);
 		lua_rawgeti(_lua, LUA_REGISTRYINDEX, callback.Reference);
 		lua_pushinteger(_lua, relAddr.Address);
@@ -318,11 +344,81 @@ void ScriptingContext::InternalCallMemoryCallback(AddressInfo relAddr, T& value,
 			lua_settop(_lua, top);
 		}
 	}
+
+	if(!needTimerReset) {
+		AddExecutionTime(_timer.GetElapsedMS());
+	}
+}
+
+void ScriptingContext::CallBatchedMemoryCallback(MemoryCallback& callback)
+{
+	if(callback.PendingAccesses.empty()) {
+		return;
+	}
+
+	//The caller is responsible for starting the timer and adding the execution time
+	//Pass the addresses and values as 2 arrays to avoid creating a table per access
+	int count = (int)callback.PendingAccesses.size();
+	int top = lua_gettop(_lua);
+	lua_rawgeti(_lua, LUA_REGISTRYINDEX, callback.Reference);
+	lua_createtable(_lua, count, 0);
+	for(int i = 0; i < count; i++) {
+		lua_pushinteger(_lua, callback.PendingAccesses[i].Address);
+		lua_rawseti(_lua, -2, i + 1);
+	}
+	lua_createtable(_lua, count, 0);
+	for(int i = 0; i < count; i++) {
+		lua_pushinteger(_lua, callback.PendingAccesses[i].Value);
+		lua_rawseti(_lua, -2, i + 1);
+	}
+	callback.PendingAccesses.clear();
+
+	if(lua_pcall(_lua, 2, 0, 0) != 0) {
+		Log(lua_tostring(_lua, -1));
+	}
+	lua_settop(_lua, top);
+}
+
+void ScriptingContext::AddExecutionTime(double time)
+{
+	_frameExecutionTime += time;
+	_totalExecutionTime += time;
+}
+
+void ScriptingContext::FlushBatchedMemoryCallbacks()
+{
+	bool needTimerReset = true;
+	for(int i = (int)CallbackType::Read; i <= (int)CallbackType::Exec; i++) {
+		for(size_t j = 0; j < _callbacks[i].size(); j++) {
+			if(_callbacks[i][j].Batched && !_callbacks[i][j].PendingAccesses.empty()) {
+				if(needTimerReset) {
+					_timer.Reset();
+					_context = this;
+					lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
+					LuaApi::SetContext(this);
+					needTimerReset = false;
+				}
+				CallBatchedMemoryCallback(_callbacks[i][j]);
+			}
+		}
+	}
+
+	if(!needTimerReset) {
+		AddExecutionTime(_timer.GetElapsedMS());
+	}
 }
 
 int ScriptingContext::CallEventCallback(EventType type, CpuType cpuType)
 {
+	if(type == EventType::EndFrame || type == EventType::ScriptEnded) {
+		FlushBatchedMemoryCallbacks();
+	}
+
 	if(_eventCallbacks[(int)type].empty()) {
+		if(type == EventType::EndFrame) {
+			_lastFrameExecutionTime = _frameExecutionTime;
+			_frameExecutionTime = 0;
+		}
 		return 0;
 	}
 
@@ -338,6 +434,12 @@ int ScriptingContext::CallEventCallback(EventType type, CpuType cpuType)
 			Log(lua_tostring(_lua, -1));
 		}
 	}
+
+	AddExecutionTime(_timer.GetElapsedMS());
+	if(type == EventType::EndFrame) {
+		_lastFrameExecutionTime = _frameExecutionTime;
+		_frameExecutionTime = 0;
+	}
 	return l.ReturnCount();
 }
 
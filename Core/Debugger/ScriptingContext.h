@@ -16,6 +16,12 @@ enum class CallbackType
 	Exec = 2
 };
 
+struct BatchedMemoryAccess
+{
+	uint32_t Address;
+	uint32_t Value;
+};
+
 struct MemoryCallback
 {
 	uint32_t StartAddress;
@@ -23,6 +29,10 @@ struct MemoryCallback
 	CpuType Cpu;
 	MemoryType MemType;
 	int Reference;
+
+	//Batched callbacks are called once per frame with all matching accesses
+	bool Batched = false;
+	vector<BatchedMemoryAccess> PendingAccesses;
 };
 
 enum class ScriptDrawSurface
@@ -34,6 +44,8 @@ enum class ScriptDrawSurface
 class ScriptingContext
 {
 private:
+	static constexpr size_t MaxBatchSize = 0x10000;
+
 	static ScriptingContext* _context;
 	lua_State* _lua = nullptr;
 	Timer _timer;
@@ -49,6 +61,11 @@ private:
 
 	ScriptDrawSurface _drawSurface = ScriptDrawSurface::ConsoleScreen;
 
+	//Time spent running Lua callbacks, in milliseconds
+	double _frameExecutionTime = 0;
+	double _lastFrameExecutionTime = 0;
+	double _totalExecutionTime = 0;
+
 	static void ExecutionCountHook(lua_State* lua);
 	void LuaOpenLibs(lua_State* L, bool allowIoOsAccess);
 
@@ -62,6 +79,9 @@ protected:
 	template<typename T> void InternalCallMemoryCallback(AddressInfo relAddr, T& value, CallbackType type, CpuType cpuType);
 
 	bool IsAddressMatch(MemoryCallback& callback, AddressInfo addr);
+	void CallBatchedMemoryCallback(MemoryCallback& callback);
+	void FlushBatchedMemoryCallbacks();
+	void AddExecutionTime(double time);
 
 public:
 	ScriptingContext(Debugger* debugger);
@@ -82,12 +102,15 @@ public:
 	bool CheckInitDone();
 	bool IsSaveStateAllowed();
 
+	double GetLastFrameExecutionTime() { return _lastFrameExecutionTime; }
+	double GetTotalExecutionTime() { return _totalExecutionTime; }
+
 	CpuType GetDefaultCpuType() { return _defaultCpuType; }
 	MemoryType GetDefaultMemType() { return _defaultMemType; }
 	
 	void RefreshMemoryCallbackFlags();
 
-	void RegisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference);
+	void RegisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference, bool batched = false);
 	void UnregisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference);
 	void RegisterEventCallback(EventType type, int reference);
 	void UnregisterEventCallback(EventType type, int reference);
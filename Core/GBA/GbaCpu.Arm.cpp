@@ -5,6 +5,7 @@
 
 GbaArmOpCategory GbaCpu::_armCategory[0x1000];
 GbaCpu::Func GbaCpu::_armTable[0x1000];
+uint16_t GbaCpu::_conditionLut[0x10];
 
 GbaArmOpCategory GbaCpu::GetArmOpCategory(uint32_t opCode)
 {
@@ -14,7 +15,7 @@ GbaArmOpCategory GbaCpu::GetArmOpCategory(uint32_t opCode)
 
 void GbaCpu::ArmBranchExchangeRegister()
 {
-	uint32_t value = R(_opCode & 0x0F);
+	uint32_t value = R(_op->Reg0);
 	_state.CPSR.Thumb = (value & 0x01) != 0;
 	_state.R[15] = value;
 	_state.Pipeline.ReloadRequested = true;
@@ -55,7 +56,7 @@ void GbaCpu::ArmMsr()
 			value = RotateRight(value, shift * 2);
 		}
 	} else {
-		value = R(_opCode & 0x0F);
+		value = R(_op->Reg0);
 	}
 
 	GbaCpuFlags& flags = writeToSpsr ? GetSpsr() : _state.CPSR;
@@ -86,7 +87,7 @@ void GbaCpu::ArmMrs()
 	//s: source psr
 	//d: destination reg
 	bool useSpsr = _opCode & (1 << 22);
-	uint8_t rd = (_opCode >> 12) & 0x0F;
+	uint8_t rd = _op->Reg12;
 	SetR(rd, useSpsr ? GetSpsr().ToInt32() : _state.CPSR.ToInt32());
 }
 
@@ -102,9 +103,9 @@ void GbaCpu::ArmDataProcessing()
 	//p: 2nd operand
 
 	bool immediate = (_opCode & (1 << 25)) != 0;
-	uint8_t rn = (_opCode >> 16) & 0x0F;
+	uint8_t rn = _op->Reg16;
 	uint32_t op1 = R(rn);
-	uint8_t dstReg = (_opCode >> 12) & 0x0F;
+	uint8_t dstReg = _op->Reg12;
 	bool updateFlags = (_opCode & (1 << 20)) != 0;
 
 	uint32_t op2;
@@ -118,14 +119,14 @@ void GbaCpu::ArmDataProcessing()
 	} else {
 		uint8_t shiftType = (_opCode >> 5) & 0x03;
 		uint8_t shift;
-		uint8_t rm = _opCode & 0x0F;
+		uint8_t rm = _op->Reg0;
 		op2 = R(rm);
 
 		bool useRegValue = _opCode & (1 << 4);
 		if(useRegValue) {
 			//Shift amount in register
 			Idle();
-			uint8_t rs = (_opCode >> 8) & 0x0F;
+			uint8_t rs = _op->Reg8;
 			shift = R(rs) + (rs == 15 ? 4 : 0);
 			if(rm == 15) {
 				op2 += 4;
@@ -175,10 +176,10 @@ void GbaCpu::ArmMultiply()
 {
 	//Multiply and Multiply-Accumulate (MUL, MLA)
 	//----_0000_00as_dddd_nnnn_ssss_1001_mmmm
-	uint8_t rd = (_opCode >> 16) & 0x0F;
-	uint8_t rn = (_opCode >> 12) & 0x0F;
-	uint8_t rs = (_opCode >> 8) & 0x0F;
-	uint8_t rm = _opCode & 0x0F;
+	uint8_t rd = _op->Reg16;
+	uint8_t rn = _op->Reg12;
+	uint8_t rs = _op->Reg8;
+	uint8_t rm = _op->Reg0;
 	bool updateFlags = (_opCode & (1 << 20)) != 0;
 	bool multAndAcc = (_opCode & (1 << 21)) != 0;
 
@@ -213,10 +214,10 @@ void GbaCpu::ArmMultiplyLong()
 {
 	//Multiply Long and Multiply-Accumulate Long (MULL,MLAL)
 	//----_0000_1uas_hhhh_llll_ssss_1001_mmmm
-	uint8_t rh = (_opCode >> 16) & 0x0F;
-	uint8_t rl = (_opCode >> 12) & 0x0F;
-	uint8_t rs = (_opCode >> 8) & 0x0F;
-	uint8_t rm = _opCode & 0x0F;
+	uint8_t rh = _op->Reg16;
+	uint8_t rl = _op->Reg12;
+	uint8_t rs = _op->Reg8;
+	uint8_t rm = _op->Reg0;
 	
 	bool updateFlags = (_opCode & (1 << 20)) != 0;
 	bool multAndAcc = (_opCode & (1 << 21)) != 0;
@@ -286,8 +287,8 @@ void GbaCpu::ArmSingleDataTransfer()
 	bool byte = (_opCode & (1 << 22)) != 0;
 	bool writeBack = (_opCode & (1 << 21)) != 0;
 	bool load = (_opCode & (1 << 20)) != 0;
-	uint8_t rn = (_opCode >> 16) & 0x0F;
-	uint8_t rd = (_opCode >> 12) & 0x0F;
+	uint8_t rn = _op->Reg16;
+	uint8_t rd = _op->Reg12;
 	
 	uint32_t addr = R(rn);
 	
@@ -297,7 +298,7 @@ void GbaCpu::ArmSingleDataTransfer()
 	} else {
 		uint8_t shiftType = (_opCode >> 5) & 0x03;
 		uint8_t shift;
-		uint8_t rm = _opCode & 0x0F;
+		uint8_t rm = _op->Reg0;
 		shift = (_opCode >> 7) & 0x1F;
 
 		offset = R(rm);
@@ -340,8 +341,8 @@ void GbaCpu::ArmSignedHalfDataTransfer()
 	bool immediate = (_opCode & (1 << 22)) != 0;
 	bool writeBack = (_opCode & (1 << 21)) != 0;
 	bool load = (_opCode & (1 << 20)) != 0;
-	uint8_t rn = (_opCode >> 16) & 0x0F;
-	uint8_t rd = (_opCode >> 12) & 0x0F;
+	uint8_t rn = _op->Reg16;
+	uint8_t rd = _op->Reg12;
 	
 	bool sign = (_opCode & (1 << 6)) != 0;
 	bool half = (_opCode & (1 << 5)) != 0;
@@ -350,7 +351,7 @@ void GbaCpu::ArmSignedHalfDataTransfer()
 	if(immediate) {
 		offset = ((_opCode >> 4) & 0xF0) | (_opCode & 0x0F);
 	} else {
-		uint8_t rm = _opCode & 0x0F;
+		uint8_t rm = _op->Reg0;
 		offset = (int32_t)R(rm);
 	}
 
@@ -400,7 +401,7 @@ void GbaCpu::ArmBlockDataTransfer()
 	bool psrForceUser = (_opCode & (1 << 22)) != 0;
 	bool writeBack = (_opCode & (1 << 21)) != 0;
 	bool load = (_opCode & (1 << 20)) != 0;
-	uint8_t rn = (_opCode >> 16) & 0x0F;
+	uint8_t rn = _op->Reg16;
 	uint16_t regMask = (uint16_t)_opCode;
 
 	uint32_t base = R(rn) + (rn == 15 ? 4 : 0);
@@ -474,9 +475,9 @@ void GbaCpu::ArmSingleDataSwap()
 	//Single Data Swap (SWP)
 	//----_0001_0b00_nnnn_dddd_0000_1001_mmmm
 	bool byte = _opCode & (1 << 22);
-	uint8_t rn = (_opCode >> 16) & 0x0F;
-	uint8_t rd = (_opCode >> 12) & 0x0F;
-	uint8_t rm = _opCode & 0x0F;
+	uint8_t rn = _op->Reg16;
+	uint8_t rd = _op->Reg12;
+	uint8_t rm = _op->Reg0;
 
 	uint32_t mode = byte ? GbaAccessMode::Byte : GbaAccessMode::Word;
 #ifndef DUMMYCPU
@@ -504,7 +505,7 @@ void GbaCpu::ArmInvalidOp()
 #endif
 }
 
-bool GbaCpu::CheckConditions(uint32_t condCode)
+bool GbaCpu::EvalCondition(uint8_t condCode, bool n, bool z, bool c, bool v)
 {
 	/*Code Suffix Flags Meaning
 		0000 EQ Z set equal
@@ -524,20 +525,20 @@ bool GbaCpu::CheckConditions(uint32_t condCode)
 		1110 AL(ignored) always
 	*/
 	switch(condCode) {
-		case 0: return _state.CPSR.Zero;
-		case 1: return !_state.CPSR.Zero;
-		case 2: return _state.CPSR.Carry;
-		case 3: return !_state.CPSR.Carry;
-		case 4: return _state.CPSR.Negative;
-		case 5: return !_state.CPSR.Negative;
-		case 6: return _state.CPSR.Overflow;
-		case 7: return !_state.CPSR.Overflow;
-		case 8: return _state.CPSR.Carry && !_state.CPSR.Zero;
-		case 9: return !_state.CPSR.Carry || _state.CPSR.Zero;
-		case 10: return _state.CPSR.Negative == _state.CPSR.Overflow;
-		case 11: return _state.CPSR.Negative != _state.CPSR.Overflow;
-		case 12: return !_state.CPSR.Zero && (_state.CPSR.Negative == _state.CPSR.Overflow);
-		case 13: return _state.CPSR.Zero || (_state.CPSR.Negative != _state.CPSR.Overflow);
+		case 0: return z;
+		case 1: return !z;
+		case 2: return c;
+		case 3: return !c;
+		case 4: return n;
+		case 5: return !n;
+		case 6: return v;
+		case 7: return !v;
+		case 8: return c && !z;
+		case 9: return !c || z;
+		case 10: return n == v;
+		case 11: return n != v;
+		case 12: return !z && (n == v);
+		case 13: return z || (n != v);
 		case 14: return true;
 		case 15: return false;
 	}
@@ -556,6 +557,15 @@ void GbaCpu::InitArmOpTable()
 		addEntry(i, &GbaCpu::ArmInvalidOp, GbaArmOpCategory::InvalidOp);
 	}
 
+	for(int cond = 0; cond < 0x10; cond++) {
+		_conditionLut[cond] = 0;
+		for(int flags = 0; flags < 0x10; flags++) {
+			if(EvalCondition(cond, flags & 0x08, flags & 0x04, flags & 0x02, flags & 0x01)) {
+				_conditionLut[cond] |= (1 << flags);
+			}
+		}
+	}
+
 	//Data Processing / PSR Transfer (MRS, MSR)
 	//----_00??_????_----_----_----_????_----
 	for(int i = 0; i <= 0x3FF; i++) {
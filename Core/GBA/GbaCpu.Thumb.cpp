@@ -361,9 +361,7 @@ void GbaCpu::ThumbMultipleLoadStore()
 void GbaCpu::ThumbConditionalBranch()
 {
 	int16_t offset = ((int16_t)(int8_t)(_opCode & 0xFF)) << 1;
-	uint8_t cond = (_opCode >> 8) & 0x0F;
-	
-	if(CheckConditions(cond)) {
+	if(CheckConditions(_op->Condition)) {
 		SetR(15, _state.R[15] + offset);
 	}
 }
@@ -106,12 +106,14 @@ void GbaCpu::ReloadPipeline()
 
 	pipe.ReloadRequested = false;
 	pipe.Fetch.Address = _state.R[15] = _state.R[15] & (_state.CPSR.Thumb ? ~0x01 : ~0x03);
-	pipe.Fetch.OpCode = ReadCode(pipe.Mode, pipe.Fetch.Address);
+	FetchCode(pipe.Fetch);
 	pipe.Execute = pipe.Decode;
 	pipe.Decode = pipe.Fetch;
+	_executeVersion = _decodeVersion;
+	_decodeVersion = _fetchVersion;
 
 	pipe.Fetch.Address = _state.R[15] = _state.CPSR.Thumb ? (_state.R[15] + 2) : (_state.R[15] + 4);
-	pipe.Fetch.OpCode = ReadCode(pipe.Mode, pipe.Fetch.Address);
+	FetchCode(pipe.Fetch);
 }
 
 void GbaCpu::CheckForIrqs()
@@ -318,6 +320,10 @@ void GbaCpu::SetProgramCounter(uint32_t addr, bool thumb)
 	pipe.Decode.OpCode = _memoryManager->DebugCpuRead(pipe.Mode, pipe.Decode.Address);
 	pipe.Fetch.Address = _state.R[15] = _state.CPSR.Thumb ? (_state.R[15] + 2) : (_state.R[15] + 4);
 	pipe.Fetch.OpCode = _memoryManager->DebugCpuRead(pipe.Mode, pipe.Fetch.Address);
+
+	_fetchVersion = 0;
+	_decodeVersion = 0;
+	_executeVersion = 0;
 }
 
 GbaCpuState& GbaCpu::GetState()
@@ -401,4 +407,11 @@ void GbaCpu::Serialize(Serializer& s)
 	SV(_state.UndefinedSpsr.Negative);
 
 	SV(_state.CycleCount);
+
+	if(!s.IsSaving()) {
+		//The pipeline's opcodes weren't fetched with the current page versions
+		_fetchVersion = 0;
+		_decodeVersion = 0;
+		_executeVersion = 0;
+	}
 }
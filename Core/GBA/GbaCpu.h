@@ -29,6 +29,77 @@ private:
 	static Func _thumbTable[0x100];
 	static GbaArmOpCategory _armCategory[0x1000];
 	static GbaThumbOpCategory _thumbCategory[0x100];
+	static uint16_t _conditionLut[0x10];
+
+	struct DecodedOp
+	{
+		Func Handler;
+		//Version of the opcode's EWRAM/IWRAM page when it was fetched (see GbaMemoryManager::GetCodePageVersion)
+		uint64_t Version;
+		bool Thumb;
+		//ARM: condition code - THUMB: condition code of conditional branches
+		uint8_t Condition;
+		//ARM register fields, named after their bit position
+		uint8_t Reg16;
+		uint8_t Reg12;
+		uint8_t Reg8;
+		uint8_t Reg0;
+	};
+
+	static constexpr uint32_t DecodedOpsPerPage = (1 << GbaMemoryManager::CodePageShift) / 2;
+
+	//Decoded instruction for the opcode being executed
+	DecodedOp* _op = nullptr;
+	DecodedOp _uncachedOp = {};
+
+	//Page versions for the opcodes in the pipeline, 0 when the opcode isn't from EWRAM/IWRAM (or its version is unknown)
+	uint64_t _fetchVersion = 0;
+	uint64_t _decodeVersion = 0;
+	uint64_t _executeVersion = 0;
+
+#ifndef DUMMYCPU
+	//Decoded instructions for each EWRAM/IWRAM page (one entry per halfword), allocated when code is first executed from the page
+	unique_ptr<DecodedOp[]> _decodedPages[GbaMemoryManager::CodePageCount];
+#endif
+
+	__forceinline void DecodeOpCode(DecodedOp& op, uint32_t opCode, bool thumb)
+	{
+		op.Thumb = thumb;
+		if(thumb) {
+			op.Handler = _thumbTable[(opCode >> 8) & 0xFF];
+			op.Condition = (opCode >> 8) & 0x0F;
+		} else {
+			op.Handler = _armTable[((opCode & 0x0FF00000) >> 16) | ((opCode & 0xF0) >> 4)];
+			op.Condition = opCode >> 28;
+			op.Reg16 = (opCode >> 16) & 0x0F;
+			op.Reg12 = (opCode >> 12) & 0x0F;
+			op.Reg8 = (opCode >> 8) & 0x0F;
+			op.Reg0 = opCode & 0x0F;
+		}
+	}
+
+	__forceinline DecodedOp* GetDecodedOp(uint32_t addr, uint32_t opCode, bool thumb)
+	{
+#ifndef DUMMYCPU
+		if(_executeVersion) {
+			//Nothing was written to the page since the cached entry was decoded if its version matches the version at fetch time
+			unique_ptr<DecodedOp[]>& page = _decodedPages[GbaMemoryManager::GetCodePageIndex(addr)];
+			if(!page) {
+				page.reset(new DecodedOp[DecodedOpsPerPage]());
+			}
+
+			DecodedOp& op = page[(addr & ((1 << GbaMemoryManager::CodePageShift) - 1)) >> 1];
+			if(op.Version != _executeVersion || op.Thumb != thumb) {
+				DecodeOpCode(op, opCode, thumb);
+				op.Version = _executeVersion;
+			}
+			return &op;
+		}
+#endif
+
+		DecodeOpCode(_uncachedOp, opCode, thumb);
+		return &_uncachedOp;
+	}
 
 	uint32_t Add(uint32_t op1, uint32_t op2, bool carry, bool updateFlags);
 	uint32_t Sub(uint32_t op1, uint32_t op2, bool carry, bool updateFlags);
@@ -69,7 +140,14 @@ private:
 	void ArmSoftwareInterrupt();
 	void ArmInvalidOp();
 
-	bool CheckConditions(uint32_t condCode);
+	static bool EvalCondition(uint8_t condCode, bool n, bool z, bool c, bool v);
+
+	__forceinline bool CheckConditions(uint32_t condCode)
+	{
+		//Each LUT entry contains the result of the condition for all 16 possible NZCV flag combinations
+		uint8_t flags = (_state.CPSR.Negative << 3) | (_state.CPSR.Zero << 2) | (_state.CPSR.Carry << 1) | (uint8_t)_state.CPSR.Overflow;
+		return _conditionLut[condCode] & (1 << flags);
+	}
 
 	static void InitThumbOpTable();
 	void ThumbMoveShiftedRegister();
@@ -106,9 +184,18 @@ private:
 
 		pipe.Execute = pipe.Decode;
 		pipe.Decode = pipe.Fetch;
+		_executeVersion = _decodeVersion;
+		_decodeVersion = _fetchVersion;
 
 		pipe.Fetch.Address = _state.R[15] = _state.CPSR.Thumb ? (_state.R[15] + 2) : (_state.R[15] + 4);
-		pipe.Fetch.OpCode = ReadCode(pipe.Mode, pipe.Fetch.Address);
+		FetchCode(pipe.Fetch);
+	}
+
+	__forceinline void FetchCode(GbaInstructionData& entry)
+	{
+		//The version is read before the opcode - a write during the fetch (e.g by DMA) can then only cause a cache miss
+		_fetchVersion = _memoryManager->GetCodePageVersion(entry.Address);
+		entry.OpCode = ReadCode(_state.Pipeline.Mode, entry.Address);
 	}
 
 	uint32_t ReadCode(GbaAccessModeVal mode, uint32_t addr);
@@ -187,16 +274,24 @@ public:
 #endif
 
 		_opCode = _state.Pipeline.Execute.OpCode;
-		if(_state.CPSR.Thumb) {
-			(this->*_thumbTable[(_opCode >> 8) & 0xFF])();
+		bool thumb = _state.CPSR.Thumb;
+		if constexpr(debuggerEnabled) {
+			//The debugger can change memory and the pipeline without going through the memory manager, don't use the cache
+			DecodeOpCode(_uncachedOp, _opCode, thumb);
+			_op = &_uncachedOp;
+		} else {
+			_op = GetDecodedOp(_state.Pipeline.Execute.Address, _opCode, thumb);
+		}
+
+		if(thumb) {
+			(this->*_op->Handler)();
 		} else {
 #ifndef DUMMYCPU
-			if(CheckConditions(_opCode >> 28)) {
+			if(CheckConditions(_op->Condition)) {
 #else 
 			{
 #endif
-				uint16_t opType = ((_opCode & 0x0FF00000) >> 16) | ((_opCode & 0xF0) >> 4);
-				(this->*_armTable[opType])();
+				(this->*_op->Handler)();
 			}
 		}
 
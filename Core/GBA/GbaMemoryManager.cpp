@@ -45,6 +45,8 @@ GbaMemoryManager::GbaMemoryManager(Emulator* emu, GbaConsole* console, GbaPpu* p
 
 	_waitStatesLut = new uint8_t[0x400];
 	GenerateWaitStateLut();
+	InitFastReadPages();
+	InvalidateCodePages();
 
 	//Used to get the correct timing for the timer prescaler, based on the "timer" test
 	_masterClock = 48;
@@ -61,6 +63,23 @@ GbaMemoryManager::~GbaMemoryManager()
 	delete[] _waitStatesLut;
 }
 
+void GbaMemoryManager::InitFastReadPages()
+{
+	//Only regions whose reads are plain memory lookups with no side effects (other than the open bus values) are added here
+	//The bios (open bus behavior), I/O, VRAM (mirroring/bitmap mode behavior), and bank $D (EEPROM) use InternalRead
+	_fastReadPages[0x02] = { _extWorkRam, GbaConsole::ExtWorkRamSize - 1, GbaConsole::ExtWorkRamSize };
+	_fastReadPages[0x03] = { _intWorkRam, GbaConsole::IntWorkRamSize - 1, GbaConsole::IntWorkRamSize };
+	_fastReadPages[0x05] = { _palette, GbaConsole::PaletteRamSize - 1, GbaConsole::PaletteRamSize };
+	_fastReadPages[0x07] = { _oam, GbaConsole::SpriteRamSize - 1, GbaConsole::SpriteRamSize };
+
+	if(_prgRom) {
+		//Reads past the end of the ROM return the address bits and must use the slow path
+		for(int i = 0x08; i <= 0x0C; i++) {
+			_fastReadPages[i] = { _prgRom, 0x1FFFFFF, _prgRomSize };
+		}
+	}
+}
+
 void GbaMemoryManager::ProcessIdleCycle()
 {
 	if(_state.PrefetchEnabled) {
@@ -247,13 +266,31 @@ uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr)
 	uint32_t value;
 
 	bool isSigned = mode & GbaAccessMode::Signed;
+	bool isCart = addr >= 0x8000000;
 	if(mode & GbaAccessMode::Byte) {
-		value = _state.InternalOpenBus[0] = InternalRead(mode, addr, addr);
+		if(uint8_t* src = GetFastReadPtr(addr, 1)) {
+			value = _state.InternalOpenBus[0] = src[0];
+			if(isCart) {
+				_state.CartOpenBus[addr & 0x01] = (uint8_t)value;
+			}
+		} else {
+			value = _state.InternalOpenBus[0] = InternalRead(mode, addr, addr);
+		}
 		value = isSigned ? (uint32_t)(int8_t)value : (uint8_t)value;
 		_emu->ProcessMemoryRead<CpuType::Gba, 1>(addr, value, mode & GbaAccessMode::Prefetch ? MemoryOperationType::ExecOpCode : MemoryOperationType::Read);
 	} else if(mode & GbaAccessMode::HalfWord) {
-		uint8_t b0 = _state.InternalOpenBus[0] = InternalRead(mode, addr & ~0x01, addr);
-		uint8_t b1 = _state.InternalOpenBus[1] = InternalRead(mode, addr | 1, addr);
+		uint8_t b0, b1;
+		if(uint8_t* src = GetFastReadPtr(addr & ~0x01, 2)) {
+			b0 = _state.InternalOpenBus[0] = src[0];
+			b1 = _state.InternalOpenBus[1] = src[1];
+			if(isCart) {
+				_state.CartOpenBus[0] = b0;
+				_state.CartOpenBus[1] = b1;
+			}
+		} else {
+			b0 = _state.InternalOpenBus[0] = InternalRead(mode, addr & ~0x01, addr);
+			b1 = _state.InternalOpenBus[1] = InternalRead(mode, addr | 1, addr);
+		}
 		value = b0 | (b1 << 8);
 		value = isSigned ? (uint32_t)(int16_t)value : (uint16_t)value;
 		if(!(mode & GbaAccessMode::NoRotate)) {
@@ -261,10 +298,22 @@ uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr)
 		}
 		_emu->ProcessMemoryRead<CpuType::Gba, 2>(addr & ~0x01, value, mode & GbaAccessMode::Prefetch ? MemoryOperationType::ExecOpCode : MemoryOperationType::Read);
 	} else {
-		uint8_t b0 = _state.InternalOpenBus[0] = InternalRead(mode, addr & ~0x03, addr);
-		uint8_t b1 = _state.InternalOpenBus[1] = InternalRead(mode, (addr & ~0x03) | 1, addr);
-		uint8_t b2 = _state.InternalOpenBus[2] = InternalRead(mode, (addr & ~0x03) | 2, addr);
-		uint8_t b3 = _state.InternalOpenBus[3] = InternalRead(mode, addr | 3, addr);
+		uint8_t b0, b1, b2, b3;
+		if(uint8_t* src = GetFastReadPtr(addr & ~0x03, 4)) {
+			b0 = _state.InternalOpenBus[0] = src[0];
+			b1 = _state.InternalOpenBus[1] = src[1];
+			b2 = _state.InternalOpenBus[2] = src[2];
+			b3 = _state.InternalOpenBus[3] = src[3];
+			if(isCart) {
+				_state.CartOpenBus[0] = b2;
+				_state.CartOpenBus[1] = b3;
+			}
+		} else {
+			b0 = _state.InternalOpenBus[0] = InternalRead(mode, addr & ~0x03, addr);
+			b1 = _state.InternalOpenBus[1] = InternalRead(mode, (addr & ~0x03) | 1, addr);
+			b2 = _state.InternalOpenBus[2] = InternalRead(mode, (addr & ~0x03) | 2, addr);
+			b3 = _state.InternalOpenBus[3] = InternalRead(mode, addr | 3, addr);
+		}
 		value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
 		if(!(mode & GbaAccessMode::NoRotate)) {
 			value = RotateValue(mode, addr, value, isSigned);
@@ -390,8 +439,15 @@ void GbaMemoryManager::InternalWrite(GbaAccessModeVal mode, uint32_t addr, uint8
 			//bootrom
 			break;
 
-		case 0x02: _extWorkRam[addr & (GbaConsole::ExtWorkRamSize - 1)] = value; break;
-		case 0x03: _intWorkRam[addr & (GbaConsole::IntWorkRamSize - 1)] = value; break;
+		case 0x02:
+			_extWorkRam[addr & (GbaConsole::ExtWorkRamSize - 1)] = value;
+			_codePageVersions[(addr & (GbaConsole::ExtWorkRamSize - 1)) >> CodePageShift]++;
+			break;
+
+		case 0x03:
+			_intWorkRam[addr & (GbaConsole::IntWorkRamSize - 1)] = value;
+			_codePageVersions[(GbaConsole::ExtWorkRamSize | (addr & (GbaConsole::IntWorkRamSize - 1))) >> CodePageShift]++;
+			break;
 
 		case 0x04:
 			//registers
@@ -714,6 +770,13 @@ uint8_t GbaMemoryManager::DebugRead(uint32_t addr)
 	return _state.InternalOpenBus[addr & 0x01];
 }
 
+void GbaMemoryManager::InvalidateCodePages()
+{
+	for(uint32_t i = 0; i < CodePageCount; i++) {
+		_codePageVersions[i]++;
+	}
+}
+
 void GbaMemoryManager::DebugWrite(uint32_t addr, uint8_t value)
 {
 	uint8_t bank = (addr >> 24);
@@ -725,8 +788,15 @@ void GbaMemoryManager::DebugWrite(uint32_t addr, uint8_t value)
 			}
 			break;
 
-		case 0x02: _extWorkRam[addr & (GbaConsole::ExtWorkRamSize - 1)] = value; break;
-		case 0x03: _intWorkRam[addr & (GbaConsole::IntWorkRamSize - 1)] = value; break;
+		case 0x02:
+			_extWorkRam[addr & (GbaConsole::ExtWorkRamSize - 1)] = value;
+			_codePageVersions[(addr & (GbaConsole::ExtWorkRamSize - 1)) >> CodePageShift]++;
+			break;
+
+		case 0x03:
+			_intWorkRam[addr & (GbaConsole::IntWorkRamSize - 1)] = value;
+			_codePageVersions[(GbaConsole::ExtWorkRamSize | (addr & (GbaConsole::IntWorkRamSize - 1))) >> CodePageShift]++;
+			break;
 
 		case 0x04:
 			//todogba debugger - allow writing to registers
@@ -860,5 +930,6 @@ void GbaMemoryManager::Serialize(Serializer& s)
 
 	if(!s.IsSaving()) {
 		GenerateWaitStateLut();
+		InvalidateCodePages();
 	}
 }
\ No newline at end of file
@@ -19,7 +19,19 @@ class GbaRomPrefetch;
 
 class GbaMemoryManager final : public ISerializable
 {
+public:
+	//EWRAM and IWRAM are split into 256-byte pages for the CPU's decoded instruction cache (EWRAM pages first, then IWRAM)
+	static constexpr uint32_t CodePageShift = 8;
+	static constexpr uint32_t CodePageCount = (0x40000 + 0x8000) >> CodePageShift;
+
 private:
+	struct FastReadPage
+	{
+		uint8_t* Memory;
+		uint32_t Mask;
+		uint32_t Size;
+	};
+
 	Emulator* _emu = nullptr;
 	GbaConsole* _console = nullptr;
 	GbaPpu* _ppu = nullptr;
@@ -55,6 +67,26 @@ private:
 
 	uint8_t* _waitStatesLut = nullptr;
 
+	//Direct pointers for regions (per 16MB bank) that can be read without side effects
+	FastReadPage _fastReadPages[0x10] = {};
+
+	//Incremented on every write to the page, 0 is never used (see GetCodePageVersion)
+	uint64_t _codePageVersions[CodePageCount] = {};
+
+	void InitFastReadPages();
+
+	__forceinline uint8_t* GetFastReadPtr(uint32_t addr, uint8_t size)
+	{
+		//addr must be aligned to size
+		if(addr >= 0x10000000) {
+			return nullptr;
+		}
+
+		FastReadPage& page = _fastReadPages[addr >> 24];
+		uint32_t offset = addr & page.Mask;
+		return (page.Memory && offset + size <= page.Size) ? page.Memory + offset : nullptr;
+	}
+
 	__forceinline void ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr);
 
 	__noinline void ProcessVramStalling(uint32_t addr);
@@ -124,6 +156,25 @@ public:
 
 	uint8_t GetOpenBus(uint32_t addr);
 
+	static __forceinline int32_t GetCodePageIndex(uint32_t addr)
+	{
+		switch(addr >> 24) {
+			case 0x02: return (addr & 0x3FFFF) >> CodePageShift;
+			case 0x03: return (0x40000 | (addr & 0x7FFF)) >> CodePageShift;
+			default: return -1;
+		}
+	}
+
+	//Returns a value that only changes when the page is written to, or 0 for addresses outside of EWRAM/IWRAM
+	__forceinline uint64_t GetCodePageVersion(uint32_t addr)
+	{
+		int32_t page = GetCodePageIndex(addr);
+		return page >= 0 ? _codePageVersions[page] : 0;
+	}
+
+	//Must be called when the content of EWRAM/IWRAM is changed without going through Write/DebugWrite
+	void InvalidateCodePages();
+
 	uint32_t DebugCpuRead(GbaAccessModeVal mode, uint32_t addr);
 	uint8_t DebugRead(uint32_t addr);
 	void DebugWrite(uint32_t addr, uint8_t value);
@@ -376,19 +376,17 @@ uint16_t GbaPpu::ReadColor(int x, uint16_t addr)
 
 void GbaPpu::BlendColors(uint16_t* dst, int x, uint16_t main, uint8_t aCoeff, uint16_t sub, uint8_t bCoeff)
 {
-	uint8_t aR = main & 0x1F;
-	uint8_t aG = (main >> 5) & 0x1F;
-	uint8_t aB = (main >> 10) & 0x1F;
+	//Spread the 3 channels into 11-bit lanes (bits 0, 11 and 22) so all channels are
+	//multiplied/added at once (max value per lane is 31*16*2, no overflow into the next lane)
+	auto spread = [](uint32_t color) { return (color & 0x1F) | ((color & 0x3E0) << 6) | ((color & 0x7C00) << 12); };
 
-	uint8_t bR = sub & 0x1F;
-	uint8_t bG = (sub >> 5) & 0x1F;
-	uint8_t bB = (sub >> 10) & 0x1F;
+	uint32_t lanes = ((spread(main) * aCoeff + spread(sub) * bCoeff) >> 4) & 0x0FC1F83F;
 
-	uint32_t r = std::min(31, (aR * aCoeff + bR * bCoeff) >> 4);
-	uint32_t g = std::min(31, (aG * aCoeff + bG * bCoeff) >> 4);
-	uint32_t b = std::min(31, (aB * aCoeff + bB * bCoeff) >> 4);
+	//Saturate lanes that are over 31
+	uint32_t overflow = lanes & 0x08010020;
+	lanes = (lanes | ((overflow >> 5) * 0x1F)) & 0x07C0F81F;
 
-	dst[x] = r | (g << 5) | (b << 10);
+	dst[x] = (lanes & 0x1F) | ((lanes >> 6) & 0x3E0) | ((lanes >> 12) & 0x7C00);
 }
 
 void GbaPpu::ApplyWindowBounds(uint8_t window)
@@ -626,51 +624,73 @@ void GbaPpu::RenderTransformTilemap()
 	int cycle = std::max(0, _lastRenderCycle + 1 - gap);
 	int end = std::min<int>(_state.Cycle, 1005) - gap;
 
+	//Keep the per-dot values in locals while rendering - the byte-sized VRAM reads and _memoryAccess
+	//writes can alias anything, which would otherwise force all of these to be reloaded/stored on every dot
+	GbaLayerRendererData& data = _layerData[i];
+	int32_t transformX = data.TransformX;
+	int32_t transformY = data.TransformY;
+	uint32_t xPos = data.XPos;
+	uint32_t yPos = data.YPos;
+	uint16_t tileIndex = data.TileIndex;
+	uint8_t tileRow = data.TileRow;
+	uint8_t tileColumn = data.TileColumn;
+	int16_t renderX = data.RenderX;
+
+	uint32_t wrapMask = layer.WrapAround ? (screenSize - 1) : 0xFFFFF;
+	uint16_t columnCount = screenSize >> 3;
+	uint8_t mosaicSize = layer.Mosaic ? _state.BgMosaicSizeX + 1 : 1;
+	int16_t matrixA = cfg.Matrix[0];
+	int16_t matrixC = cfg.Matrix[2];
+
 	for(; cycle <= end; cycle++) {
 		switch(cycle & 0x03) {
 			case 0: {
 				//Fetch tilemap data
-				uint32_t wrapMask = layer.WrapAround ? (screenSize - 1) : 0xFFFFF;
-				uint16_t columnCount = screenSize >> 3;
-
-				if(!layer.Mosaic || _layerData[i].RenderX % (_state.BgMosaicSizeX + 1) == 0) {
+				if(mosaicSize == 1 || renderX % mosaicSize == 0) {
 					//Ignore decimal point value (bottom 8 bits), apply wraparound behavior
 					//This produces the x,y coordinate (on the tilemap) that needs to be drawn
-					_layerData[i].XPos = (_layerData[i].TransformX >> 8) & wrapMask;
-					_layerData[i].YPos = (_layerData[i].TransformY >> 8) & wrapMask;
+					xPos = (transformX >> 8) & wrapMask;
+					yPos = (transformY >> 8) & wrapMask;
 				}
 
-				uint16_t vramAddr = layer.TilemapAddr + (_layerData[i].YPos >> 3) * columnCount + (_layerData[i].XPos >> 3);
-				_layerData[i].TileIndex = _vram[vramAddr];
+				uint16_t vramAddr = layer.TilemapAddr + (yPos >> 3) * columnCount + (xPos >> 3);
+				tileIndex = _vram[vramAddr];
 				_memoryAccess[cycle + gap] |= GbaPpuMemAccess::Vram;
 
-				_layerData[i].TileRow = _layerData[i].YPos & 0x07;
-				_layerData[i].TileColumn = _layerData[i].XPos & 0x07;
+				tileRow = yPos & 0x07;
+				tileColumn = xPos & 0x07;
 
 				//Update x/y values for next dot
-				_layerData[i].TransformX += cfg.Matrix[0];
-				_layerData[i].TransformY += cfg.Matrix[2];
-				//MessageManager::Log(std::to_string(_state.Scanline) + "," + std::to_string(cycle) + " fetch tilemap");
+				transformX += matrixA;
+				transformY += matrixC;
 				break;
 			}
 
 			case 1: {
 				//Fetch pixel
 				_memoryAccess[cycle + gap] |= GbaPpuMemAccess::Vram;
-				if(_layerData[i].RenderX < 240) {
-					uint8_t color = _vram[(layer.TilesetAddr + _layerData[i].TileIndex * 64 + _layerData[i].TileRow * 8 + _layerData[i].TileColumn) & 0xFFFF];
-					if(color != 0 && _layerData[i].XPos < screenSize && _layerData[i].YPos < screenSize) {
-						SetPixelData(_layerOutput[i][_layerData[i].RenderX], color * 2, layer.Priority, i);
+				if(renderX < 240) {
+					uint8_t color = _vram[(layer.TilesetAddr + tileIndex * 64 + tileRow * 8 + tileColumn) & 0xFFFF];
+					if(color != 0 && xPos < screenSize && yPos < screenSize) {
+						SetPixelData(_layerOutput[i][renderX], color * 2, layer.Priority, i);
 					}
 				}
-				_layerData[i].RenderX++;
-				//MessageManager::Log(std::to_string(_state.Scanline) + "," + std::to_string(cycle) + " fetch pixel");
+				renderX++;
 				cycle += 2;
 				break;
 			}
 		}
 	}
 
+	data.TransformX = transformX;
+	data.TransformY = transformY;
+	data.XPos = xPos;
+	data.YPos = yPos;
+	data.TileIndex = tileIndex;
+	data.TileRow = tileRow;
+	data.TileColumn = tileColumn;
+	data.RenderX = renderX;
+
 	if(_state.Cycle == 1006) {
 		//Update x/y values for next scanline
 		if(!layer.Mosaic) {
@@ -28,6 +28,7 @@ DebugTilemapInfo GbPpuTools::GetTilemap(GetTilemapOptions options, BaseState& ba
 		colorMask = 0x03;
 	}
 
+	TileRowDecoder<TileFormat::Bpp2> decoder;
 	for(int row = 0; row < 32; row++) {
 		uint16_t baseOffset = offset + ((row & 0x1F) << 5);
 
@@ -50,7 +51,7 @@ DebugTilemapInfo GbPpuTools::GetTilemap(GetTilemapOptions options, BaseState& ba
 				uint16_t pixelStart = tileStart + (vMirror ? (7 - y) : y) * 2;
 				for(int x = 0; x < 8; x++) {
 					uint8_t pixelIndex = hMirror ? (7 - x) : x;
-					uint8_t color = GetTilePixelColor<TileFormat::Bpp2>(vram, vramMask, pixelStart, pixelIndex);
+					uint8_t color = decoder.GetPixelColor(vram, vramMask, pixelStart, pixelIndex);
 
 					outBuffer[((row * 8) + y) * 256 + column * 8 + x] = palette[(bgPalette + color) & colorMask];
 				}
@@ -220,12 +221,13 @@ void GbPpuTools::GetSpriteInfo(DebugSpriteInfo& sprite, uint32_t* spritePreview,
 
 	sprite.TileAddress = tileStart;
 
+	TileRowDecoder<TileFormat::Bpp2> decoder;
 	for(int y = 0; y < sprite.Height; y++) {
 		uint16_t pixelStart = tileStart + (verticalMirror ? (sprite.Height - 1 - y) : y) * 2;
 		bool isCgb = state.CgbEnabled;
 		for(int x = 0; x < 8; x++) {
 			uint8_t shift = horizontalMirror ? (7 - x) : x;
-			uint8_t color = GetTilePixelColor<TileFormat::Bpp2>(vram, 0x3FFF, pixelStart, shift);
+			uint8_t color = decoder.GetPixelColor(vram, 0x3FFF, pixelStart, shift);
 
 			uint32_t outOffset = (y * 8) + x;
 			if(color > 0) {
@@ -24,6 +24,8 @@ void GbPpu::Init(Emulator* emu, Gameboy* gameboy, GbMemoryManager* memoryManager
 {
 	_emu = emu;
 	_gameboy = gameboy;
+	_sgb = gameboy->IsSgb() ? gameboy->GetSgb() : nullptr;
+	_cfg = &emu->GetSettings()->GetGameboyConfig();
 	_memoryManager = memoryManager;
 	_dmaController = dmaController;
 	_vram = vram;
@@ -440,11 +442,9 @@ void GbPpu::RunDrawCycle()
 
 	if(_fetchSprite == -1 && _bgFifo.Size > 0) {
 		if(_drawnPixels >= 0) {
-			GameboyConfig& cfg = _emu->GetSettings()->GetGameboyConfig();
-
 			GbFifoEntry entry = _insertGlitchBgPixel ? GbFifoEntry{} : _bgFifo.Content[_bgFifo.Position];
 			GbFifoEntry sprite = _oamFifo.Content[_oamFifo.Position];
-			if(!cfg.DisableSprites && sprite.Color != 0 && (entry.Color == 0 || (!(sprite.Attributes & 0x80) && !(entry.Attributes & 0x80)) || (_state.CgbEnabled && !_state.BgEnabled))) {
+			if(!_cfg->DisableSprites && sprite.Color != 0 && (entry.Color == 0 || (!(sprite.Attributes & 0x80) && !(entry.Attributes & 0x80)) || (_state.CgbEnabled && !_state.BgEnabled))) {
 				//Use sprite pixel if:
 				//  -BG color is 0, OR
 				//  -Sprite is background priority AND BG does not have its priority bit set, OR
@@ -457,7 +457,7 @@ void GbPpu::RunDrawCycle()
 				}
 				_lastPixelType = GbPixelType::Object;
 			} else {
-				if(!cfg.DisableBackground) {
+				if(!_cfg->DisableBackground) {
 					if(_state.CgbEnabled) {
 						WriteBgPixel(entry.Color | ((entry.Attributes & 0x07) << 2));
 					} else {
@@ -489,8 +489,8 @@ void GbPpu::WriteBgPixel(uint8_t colorIndex)
 {
 	uint16_t outOffset = _state.Scanline * GbConstants::ScreenWidth + _drawnPixels;
 	_currentBuffer[outOffset] = LcdReadBgPalette(colorIndex) & 0x7FFF;
-	if(_gameboy->IsSgb()) {
-		_gameboy->GetSgb()->WriteLcdColor(_state.Scanline, (uint8_t)_drawnPixels, colorIndex & 0x03);
+	if(_sgb) {
+		_sgb->WriteLcdColor(_state.Scanline, (uint8_t)_drawnPixels, colorIndex & 0x03);
 	}
 }
 
@@ -498,8 +498,8 @@ void GbPpu::WriteObjPixel(uint8_t colorIndex)
 {
 	uint16_t outOffset = _state.Scanline * GbConstants::ScreenWidth + _drawnPixels;
 	_currentBuffer[outOffset] = LcdReadObjPalette(colorIndex) & 0x7FFF;
-	if(_gameboy->IsSgb()) {
-		_gameboy->GetSgb()->WriteLcdColor(_state.Scanline, (uint8_t)_drawnPixels, colorIndex & 0x03);
+	if(_sgb) {
+		_sgb->WriteLcdColor(_state.Scanline, (uint8_t)_drawnPixels, colorIndex & 0x03);
 	}
 }
 
@@ -7,12 +7,16 @@ class Emulator;
 class Gameboy;
 class GbMemoryManager;
 class GbDmaController;
+class SuperGameboy;
+struct GameboyConfig;
 
 class GbPpu : public ISerializable
 {
 private:
 	Emulator* _emu = nullptr;
 	Gameboy* _gameboy = nullptr;
+	SuperGameboy* _sgb = nullptr;
+	GameboyConfig* _cfg = nullptr;
 	GbPpuState _state = {};
 	GbMemoryManager* _memoryManager = nullptr;
 	GbDmaController* _dmaController = nullptr;
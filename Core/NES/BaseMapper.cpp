@@ -165,11 +165,31 @@ void BaseMapper::SetCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, uint8
 			_prgPages[i] = nullptr;
 			_prgMemoryAccess[i] = MemoryAccessType::NoAccess;
 		}
+		UpdateDirectReadPage((uint8_t)i);
 
 		sourceOffset += 0x100;
 	}
 }
 
+void BaseMapper::UpdateDirectReadPage(uint8_t page)
+{
+	bool hasSideEffects = _readSideEffectPages[page] || (_allowRegisterRead && _readRegisterPages[page]);
+	if(!hasSideEffects && (_prgMemoryAccess[page] & MemoryAccessType::Read)) {
+		_directReadPages[page] = _prgPages[page];
+	} else {
+		_directReadPages[page] = nullptr;
+	}
+}
+
+void BaseMapper::AddReadSideEffectRange(uint16_t startAddr, uint16_t endAddr)
+{
+	//Reads in this range must go through ReadRam (used by mappers that override ReadRam)
+	for(int i = startAddr >> 8; i <= endAddr >> 8; i++) {
+		_readSideEffectPages[i] = true;
+		UpdateDirectReadPage((uint8_t)i);
+	}
+}
+
 void BaseMapper::RemoveCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr)
 {
 	//Unmap this section of memory (causing open bus behavior)
@@ -508,6 +528,13 @@ void BaseMapper::AddRegisterRange(uint16_t startAddr, uint16_t endAddr, MemoryOp
 			_isWriteRegisterAddr[i] = true;
 		}
 	}
+
+	if((int)operation & (int)MemoryOperation::Read) {
+		for(int i = startAddr >> 8; i <= endAddr >> 8; i++) {
+			_readRegisterPages[i] = true;
+			UpdateDirectReadPage((uint8_t)i);
+		}
+	}
 }
 
 void BaseMapper::RemoveRegisterRange(uint16_t startAddr, uint16_t endAddr, MemoryOperation operation)
@@ -520,6 +547,13 @@ void BaseMapper::RemoveRegisterRange(uint16_t startAddr, uint16_t endAddr, Memor
 			_isWriteRegisterAddr[i] = false;
 		}
 	}
+
+	if((int)operation & (int)MemoryOperation::Read) {
+		for(int i = startAddr >> 8; i <= endAddr >> 8; i++) {
+			_readRegisterPages[i] = std::any_of(_isReadRegisterAddr + (i << 8), _isReadRegisterAddr + (i << 8) + 0x100, [](bool isRegister) { return isRegister; });
+			UpdateDirectReadPage((uint8_t)i);
+		}
+	}
 }
 
 void BaseMapper::Serialize(Serializer& s)
@@ -594,6 +628,7 @@ void BaseMapper::Initialize(NesConsole* console, RomData& romData)
 
 	memset(_isReadRegisterAddr, 0, sizeof(_isReadRegisterAddr));
 	memset(_isWriteRegisterAddr, 0, sizeof(_isWriteRegisterAddr));
+	memset(_readRegisterPages, 0, sizeof(_readRegisterPages));
 	AddRegisterRange(RegisterStartAddress(), RegisterEndAddress(), MemoryOperation::Any);
 
 	_prgSize = (uint32_t)romData.PrgRom.size();
@@ -647,6 +682,7 @@ void BaseMapper::Initialize(NesConsole* console, RomData& romData)
 	for(int i = 0; i < 0x100; i++) {
 		//Allow us to map a different page every 256 bytes
 		_prgPages[i] = nullptr;
+		_directReadPages[i] = nullptr;
 		_prgMemoryOffset[i] = -1;
 		_prgMemoryType[i] = PrgMemoryType::PrgRom;
 		_prgMemoryAccess[i] = MemoryAccessType::NoAccess;
@@ -25,6 +25,7 @@ private:
 	uint16_t InternalGetChrRomPageSize();
 	uint16_t InternalGetChrRamPageSize();
 	bool ValidateAddressRange(uint16_t startAddr, uint16_t endAddr);
+	void UpdateDirectReadPage(uint8_t page);
 
 	uint8_t *_nametableRam = nullptr;
 	uint8_t _nametableCount = 2;
@@ -41,6 +42,11 @@ private:
 	MemoryAccessType _prgMemoryAccess[0x100] = {};
 	uint8_t* _prgPages[0x100] = {};
 
+	//Pages that can be read by the memory manager without calling ReadRam (no registers or side effects)
+	uint8_t* _directReadPages[0x100] = {};
+	bool _readRegisterPages[0x100] = {};
+	bool _readSideEffectPages[0x100] = {};
+
 	MemoryAccessType _chrMemoryAccess[0x100] = {};
 	uint8_t* _chrPages[0x100] = {};
 
@@ -117,6 +123,7 @@ protected:
 	void SetCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, PrgMemoryType type, uint32_t sourceOffset, int8_t accessType);
 	void SetCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, uint8_t *source, uint32_t sourceOffset, uint32_t sourceSize, int8_t accessType = -1);
 	void RemoveCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr);
+	void AddReadSideEffectRange(uint16_t startAddr, uint16_t endAddr);
 
 	virtual void SelectChrPage8x(uint16_t slot, uint16_t page, ChrMemoryType memoryType = ChrMemoryType::Default);
 	virtual void SelectChrPage4x(uint16_t slot, uint16_t page, ChrMemoryType memoryType = ChrMemoryType::Default);
@@ -183,6 +190,7 @@ public:
 	uint32_t GetMapperDipSwitchCount();
 
 	uint8_t ReadRam(uint16_t addr) override;
+	uint8_t* const* GetDirectReadPages() { return _directReadPages; }
 	uint8_t PeekRam(uint16_t addr) override;
 	uint8_t DebugReadRam(uint16_t addr);
 	void WriteRam(uint16_t addr, uint8_t value) override;
@@ -321,6 +321,7 @@ void NesPpuTools::GetSpriteInfo(DebugSpriteInfo& sprite, uint32_t* spritePreview
 	}
 	sprite.TileAddress = tileStart;
 
+	TileRowDecoder<TileFormat::NesBpp2> decoder;
 	for(int y = 0; y < sprite.Height; y++) {
 		uint8_t lineOffset = verticalMirror ? (sprite.Height - 1 - y) : y;
 		uint16_t pixelStart = tileStart + lineOffset;
@@ -330,7 +331,7 @@ void NesPpuTools::GetSpriteInfo(DebugSpriteInfo& sprite, uint32_t* spritePreview
 
 		for(int x = 0; x < 8; x++) {
 			uint8_t shift = horizontalMirror ? (7 - x) : x;
-			uint8_t color = GetTilePixelColor<TileFormat::NesBpp2>(vram, 0x3FFF, pixelStart, shift);
+			uint8_t color = decoder.GetPixelColor(vram, 0x3FFF, pixelStart, shift);
 
 			uint32_t outOffset = (y * 8) + x;
 			if(color > 0) {
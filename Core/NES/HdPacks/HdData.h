@@ -114,7 +114,7 @@ struct HdPpuPixelInfo
 struct HdScreenInfo
 {
 	HdPpuPixelInfo* ScreenTiles;
-	unordered_map<uint32_t, uint8_t> WatchedAddressValues;
+	vector<uint8_t> WatchedAddressValues;
 	uint32_t FrameNumber = 0;
 
 	HdScreenInfo(const HdScreenInfo& that) = delete;
@@ -211,7 +211,7 @@ protected:
 struct HdPackBitmapInfo
 {
 private:
-	bool _initDone = false;
+	atomic<bool> _initDone = false;
 	SimpleLock _lock;
 
 public:
@@ -472,7 +472,7 @@ struct BgmTrackInfo
 struct HdPackData
 {
 private:
-	bool _cancelLoad = false;
+	atomic<bool> _cancelLoad = false;
 
 public:
 	static constexpr int BgLayerCount = 40;
@@ -484,7 +484,7 @@ public:
 	vector<unique_ptr<HdPackCondition>> Conditions;
 	vector<HdPackAdditionalSpriteInfo> AdditionalSprites;
 	vector<FallbackTileInfo> FallbackTiles;
-	unordered_set<uint32_t> WatchedMemoryAddresses;
+	vector<uint32_t> WatchedMemoryAddresses;
 	unordered_map<HdTileKey, vector<HdPackTileInfo*>> TileByKey;
 	unordered_map<string, string> PatchesByHash;
 	unordered_map<int, BgmTrackInfo> BgmFilesById;
@@ -506,17 +506,33 @@ public:
 
 	void LoadAsync()
 	{
+		vector<HdPackBitmapInfo*> bitmaps;
 		for(auto& bitmap : BackgroundFileData) {
-			bitmap->Init();
-			if(_cancelLoad) {
-				return;
-			}
+			bitmaps.push_back(bitmap.get());
 		}
 		for(auto& bitmap : ImageFileData) {
-			bitmap->Init();
-			if(_cancelLoad) {
-				return;
+			bitmaps.push_back(bitmap.get());
+		}
+
+		//Decode the PNG files on multiple threads - bitmaps that are needed by
+		//the emulation before they get decoded here are decoded on demand by Init()
+		atomic<size_t> nextIndex = 0;
+		auto decodeBitmaps = [&]() {
+			size_t index;
+			while(!_cancelLoad && (index = nextIndex++) < bitmaps.size()) {
+				bitmaps[index]->Init();
 			}
+		};
+
+		uint32_t threadCount = std::min<uint32_t>(std::max<uint32_t>(std::thread::hardware_concurrency() / 2, 1), (uint32_t)bitmaps.size());
+		vector<std::thread> threads;
+		for(uint32_t i = 1; i < threadCount; i++) {
+			threads.emplace_back(decodeBitmaps);
+		}
+		decodeBitmaps();
+
+		for(std::thread& t : threads) {
+			t.join();
 		}
 	}
 
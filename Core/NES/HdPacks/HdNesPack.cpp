@@ -17,14 +17,34 @@ HdNesPack<scale>::HdNesPack(NesConsole* console, EmuSettings* settings, HdPackDa
 	_console = console;
 	_settings = settings;
 	_hdData = hdData;
+	_stopThread = false;
+	_workDone = false;
 
 	InitializeFallbackTiles();
 	CleanupInvalidRules();
+
+	_resolvedTiles.resize(NesConstants::ScreenPixelCount);
+
+	_drawThread = std::thread([=]() {
+		//Worker thread used to draw the bottom half of the screen
+		while(!_stopThread) {
+			_waitWork.Wait();
+			if(_stopThread) {
+				break;
+			}
+
+			DrawLines(_drawStartLine, NesConstants::ScreenHeight - _drawOverscan.Bottom, _drawOutputBuffer, _drawOverscan);
+			_workDone = true;
+		}
+	});
 }
 
 template<uint32_t scale>
 HdNesPack<scale>::~HdNesPack()
 {
+	_stopThread = true;
+	_waitWork.Signal();
+	_drawThread.join();
 }
 
 template<uint32_t scale>
@@ -251,14 +271,15 @@ void HdNesPack<scale>::OnLineStart(HdPpuPixelInfo &lineFirstPixel, uint8_t y)
 			HdBackgroundInfo& bgInfo = _hdData->BackgroundsByPriority[cfg.BgPriority][cfg.BackgroundIndex];
 			bgInfo.Data->Init();
 
-			cfg.BgScrollX = (int32_t)(_scrollX * bgInfo.HorizontalScrollRatio);
-			cfg.BgScrollY = (int32_t)(scrollY * bgInfo.VerticalScrollRatio);
-			if(y >= -cfg.BgScrollY && (y + bgInfo.Top + cfg.BgScrollY + 1) * scale <= bgInfo.Data->Height) {
-				cfg.BgMinX = -cfg.BgScrollX;
-				cfg.BgMaxX = bgInfo.Data->Width / scale - bgInfo.Left - cfg.BgScrollX - 1;
+			HdBgScrollInfo& scroll = _bgScroll[y][layer * HdNesPack::PriorityLevelsPerLayer + i];
+			scroll.BgScrollX = (int32_t)(_scrollX * bgInfo.HorizontalScrollRatio);
+			scroll.BgScrollY = (int32_t)(scrollY * bgInfo.VerticalScrollRatio);
+			if(y >= -scroll.BgScrollY && (y + bgInfo.Top + scroll.BgScrollY + 1) * scale <= bgInfo.Data->Height) {
+				scroll.BgMinX = -scroll.BgScrollX;
+				scroll.BgMaxX = bgInfo.Data->Width / scale - bgInfo.Left - scroll.BgScrollX - 1;
 			} else {
-				cfg.BgMinX = -1;
-				cfg.BgMaxX = -1;
+				scroll.BgMinX = -1;
+				scroll.BgMaxX = -1;
 			}
 		}
 	}
@@ -483,27 +504,52 @@ template<uint32_t scale>
 void HdNesPack<scale>::DrawBackgroundLayer(uint8_t priority, uint32_t x, uint32_t y, uint32_t* outputBuffer, uint32_t screenWidth)
 {
 	HdBgConfig bgConfig = _bgConfig[(int)priority];
-	if((int32_t)x >= bgConfig.BgMinX && (int32_t)x <= bgConfig.BgMaxX) {
+	HdBgScrollInfo scroll = _bgScroll[y][(int)priority];
+	if((int32_t)x >= scroll.BgMinX && (int32_t)x <= scroll.BgMaxX) {
 		HdBackgroundInfo& bgInfo = _hdData->BackgroundsByPriority[bgConfig.BgPriority][bgConfig.BackgroundIndex];
 		switch(bgInfo.BlendMode) {
-			case HdPackBlendMode::Alpha: DrawCustomBackground<HdPackBlendMode::Alpha>(bgInfo, outputBuffer, x + bgConfig.BgScrollX, y + bgConfig.BgScrollY, screenWidth); break;
-			case HdPackBlendMode::Add: DrawCustomBackground<HdPackBlendMode::Add>(bgInfo, outputBuffer, x + bgConfig.BgScrollX, y + bgConfig.BgScrollY, screenWidth); break;
-			case HdPackBlendMode::Subtract: DrawCustomBackground<HdPackBlendMode::Subtract>(bgInfo, outputBuffer, x + bgConfig.BgScrollX, y + bgConfig.BgScrollY, screenWidth); break;
+			case HdPackBlendMode::Alpha: DrawCustomBackground<HdPackBlendMode::Alpha>(bgInfo, outputBuffer, x + scroll.BgScrollX, y + scroll.BgScrollY, screenWidth); break;
+			case HdPackBlendMode::Add: DrawCustomBackground<HdPackBlendMode::Add>(bgInfo, outputBuffer, x + scroll.BgScrollX, y + scroll.BgScrollY, screenWidth); break;
+			case HdPackBlendMode::Subtract: DrawCustomBackground<HdPackBlendMode::Subtract>(bgInfo, outputBuffer, x + scroll.BgScrollX, y + scroll.BgScrollY, screenWidth); break;
+		}
+	}
+}
+
+template<uint32_t scale>
+void HdNesPack<scale>::ResolveTiles(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelInfo, HdResolvedTiles &resolvedTiles)
+{
+	//Look up tiles in the same order GetPixels draws them - a fallback tile match
+	//changes the tile's index, which conditions on neighboring tiles can see
+	resolvedTiles.Tile = nullptr;
+	if(pixelInfo.Tile.TileIndex != HdPpuTileInfo::NoTile) {
+		resolvedTiles.Tile = GetCachedMatchingTile(x, y, &pixelInfo.Tile);
+	}
+
+	int lowestBgSprite = 999;
+	for(int k = pixelInfo.SpriteCount - 1; k >= 0; k--) {
+		if(pixelInfo.Sprite[k].BackgroundPriority) {
+			if(pixelInfo.Sprite[k].SpriteColorIndex != 0) {
+				lowestBgSprite = k;
+			}
+			resolvedTiles.Sprite[k] = GetMatchingTile(x, y, &pixelInfo.Sprite[k]);
+		}
+	}
+
+	for(int k = pixelInfo.SpriteCount - 1; k >= 0; k--) {
+		if(!pixelInfo.Sprite[k].BackgroundPriority && lowestBgSprite > k) {
+			resolvedTiles.Sprite[k] = GetMatchingTile(x, y, &pixelInfo.Sprite[k]);
 		}
 	}
 }
 
 template<uint32_t scale>
-void HdNesPack<scale>::GetPixels(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelInfo, uint32_t *outputBuffer, uint32_t screenWidth)
+void HdNesPack<scale>::GetPixels(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelInfo, HdResolvedTiles &resolvedTiles, uint32_t *outputBuffer, uint32_t screenWidth)
 {
-	HdPackTileInfo *hdPackTileInfo = nullptr;
+	HdPackTileInfo *hdPackTileInfo = resolvedTiles.Tile;
 	HdPackTileInfo *hdPackSpriteInfo = nullptr;
 
 	bool hasSprite = pixelInfo.SpriteCount > 0;
 	bool renderOriginalTiles = ((_hdData->OptionFlags & (int)HdPackOptions::DontRenderOriginalTiles) == 0);
-	if(pixelInfo.Tile.TileIndex != HdPpuTileInfo::NoTile) {
-		hdPackTileInfo = GetCachedMatchingTile(x, y, &pixelInfo.Tile);
-	}
 
 	int lowestBgSprite = 999;
 	
@@ -520,7 +566,7 @@ void HdNesPack<scale>::GetPixels(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelIn
 					lowestBgSprite = k;
 				}
 
-				hdPackSpriteInfo = GetMatchingTile(x, y, &pixelInfo.Sprite[k]);
+				hdPackSpriteInfo = resolvedTiles.Sprite[k];
 				if(hdPackSpriteInfo) {
 					DrawTile(pixelInfo.Sprite[k], *hdPackSpriteInfo, outputBuffer, screenWidth);
 				} else if(pixelInfo.Sprite[k].SpriteColorIndex != 0) {
@@ -550,7 +596,7 @@ void HdNesPack<scale>::GetPixels(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelIn
 	if(hasSprite) {
 		for(int k = pixelInfo.SpriteCount - 1; k >= 0; k--) {
 			if(!pixelInfo.Sprite[k].BackgroundPriority && lowestBgSprite > k) {
-				hdPackSpriteInfo = GetMatchingTile(x, y, &pixelInfo.Sprite[k]);
+				hdPackSpriteInfo = resolvedTiles.Sprite[k];
 				if(hdPackSpriteInfo) {
 					DrawTile(pixelInfo.Sprite[k], *hdPackSpriteInfo, outputBuffer, screenWidth);
 				} else if(pixelInfo.Sprite[k].SpriteColorIndex != 0) {
@@ -569,20 +615,46 @@ template<uint32_t scale>
 void HdNesPack<scale>::Process(HdScreenInfo *hdScreenInfo, uint32_t* outputBuffer, OverscanDimensions &overscan)
 {
 	_hdScreenInfo = hdScreenInfo;
-	uint32_t hdScale = GetScale();
-	uint32_t screenWidth = (NesConstants::ScreenWidth - overscan.Left - overscan.Right) * hdScale;
 
 	OnBeforeApplyFilter();
+
+	//Find the matching HD tiles for the whole frame first - the tile lookups, condition checks
+	//and lazy bitmap loading are not thread-safe and their results can depend on the order they run in
 	for(uint32_t i = overscan.Top, iMax = 240 - overscan.Bottom; i < iMax; i++) {
 		OnLineStart(hdScreenInfo->ScreenTiles[i << 8], i);
+		for(uint32_t j = overscan.Left, jMax = 256 - overscan.Right; j < jMax; j++) {
+			ResolveTiles(j, i, hdScreenInfo->ScreenTiles[i * 256 + j], _resolvedTiles[i * 256 + j]);
+		}
+	}
+
+	//Draw the top half of the screen on this thread, and the bottom half on the worker thread
+	uint32_t middleLine = (overscan.Top + 240 - overscan.Bottom) / 2;
+	_drawOutputBuffer = outputBuffer;
+	_drawOverscan = overscan;
+	_drawStartLine = middleLine;
+	_workDone = false;
+	_waitWork.Signal();
+
+	DrawLines(overscan.Top, middleLine, outputBuffer, overscan);
+
+	while(!_workDone) {}
+}
+
+template<uint32_t scale>
+void HdNesPack<scale>::DrawLines(uint32_t startLine, uint32_t endLine, uint32_t *outputBuffer, OverscanDimensions &overscan)
+{
+	uint32_t hdScale = GetScale();
+	uint32_t screenWidth = (NesConstants::ScreenWidth - overscan.Left - overscan.Right) * hdScale;
+
+	for(uint32_t i = startLine; i < endLine; i++) {
 		uint32_t bufferIndex = (i - overscan.Top) * screenWidth * hdScale;
 		uint32_t lineStartIndex = bufferIndex;
 		for(uint32_t j = overscan.Left, jMax = 256 - overscan.Right; j < jMax; j++) {
-			GetPixels(j, i, hdScreenInfo->ScreenTiles[i * 256 + j], outputBuffer + bufferIndex, screenWidth);
+			GetPixels(j, i, _hdScreenInfo->ScreenTiles[i * 256 + j], _resolvedTiles[i * 256 + j], outputBuffer + bufferIndex, screenWidth);
 			bufferIndex += hdScale;
 		}
 
-		ProcessGrayscaleAndEmphasis(hdScreenInfo->ScreenTiles[i * 256], outputBuffer + lineStartIndex, screenWidth);
+		ProcessGrayscaleAndEmphasis(_hdScreenInfo->ScreenTiles[i * 256], outputBuffer + lineStartIndex, screenWidth);
 	}
 }
 
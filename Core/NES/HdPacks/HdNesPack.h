@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "NES/HdPacks/HdData.h"
+#include "Utilities/AutoResetEvent.h"
 
 class NesConsole;
 class EmuSettings;
@@ -40,12 +41,22 @@ private:
 	{
 		int32_t BackgroundIndex = -1;
 		int32_t BgPriority = -1;
+	};
+
+	struct HdBgScrollInfo
+	{
 		int32_t BgScrollX = 0;
 		int32_t BgScrollY = 0;
 		int16_t BgMinX = -1;
 		int16_t BgMaxX = -1;
 	};
 
+	struct HdResolvedTiles
+	{
+		HdPackTileInfo* Tile;
+		HdPackTileInfo* Sprite[4];
+	};
+
 	static constexpr uint8_t PriorityLevelsPerLayer = 10;
 	static constexpr uint8_t BehindBgSpritesPriority = 0 * PriorityLevelsPerLayer;
 	static constexpr uint8_t BehindBgPriority = 1 * PriorityLevelsPerLayer;
@@ -58,6 +69,19 @@ private:
 
 	uint8_t _activeBgCount[4] = {};
 	HdBgConfig _bgConfig[40] = {};
+	HdBgScrollInfo _bgScroll[NesConstants::ScreenHeight][40] = {};
+
+	//Matching HD tiles for each pixel, found before the frame is drawn
+	vector<HdResolvedTiles> _resolvedTiles;
+
+	//The bottom half of the frame is drawn on a separate thread
+	std::thread _drawThread;
+	AutoResetEvent _waitWork;
+	atomic<bool> _stopThread;
+	atomic<bool> _workDone;
+	uint32_t* _drawOutputBuffer = nullptr;
+	OverscanDimensions _drawOverscan = {};
+	uint32_t _drawStartLine = 0;
 
 	uint32_t _palette[512] = {};
 	HdPackTileInfo* _cachedTile = nullptr;
@@ -91,7 +115,9 @@ private:
 	void BuildAdditionalTileCache(int32_t x, int32_t y, HdPpuTileInfo& tile, bool checkFallbackTiles);
 	void InsertAdditionalSprite(int32_t x, int32_t y, HdPpuTileInfo& sprite, HdPackAdditionalSpriteInfo& additionalSprite);
 
-	__forceinline void GetPixels(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelInfo, uint32_t *outputBuffer, uint32_t screenWidth);
+	__forceinline void ResolveTiles(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelInfo, HdResolvedTiles &resolvedTiles);
+	__forceinline void GetPixels(uint32_t x, uint32_t y, HdPpuPixelInfo &pixelInfo, HdResolvedTiles &resolvedTiles, uint32_t *outputBuffer, uint32_t screenWidth);
+	void DrawLines(uint32_t startLine, uint32_t endLine, uint32_t *outputBuffer, OverscanDimensions &overscan);
 	__forceinline void ProcessGrayscaleAndEmphasis(HdPpuPixelInfo &pixelInfo, uint32_t* outputBuffer, uint32_t hdScreenWidth);
 	
 	void CleanupInvalidRules();
@@ -27,16 +27,17 @@ void* HdNesPpu::OnBeforeSendFrame()
 {
 	HdScreenInfo* info = _info;
 	info->FrameNumber = _frameCount;
-	info->WatchedAddressValues.clear();
-	for(uint32_t address : _hdData->WatchedMemoryAddresses) {
+	info->WatchedAddressValues.resize(_hdData->WatchedMemoryAddresses.size());
+	for(size_t i = 0; i < _hdData->WatchedMemoryAddresses.size(); i++) {
+		uint32_t address = _hdData->WatchedMemoryAddresses[i];
 		if(address & HdPackBaseMemoryCondition::PpuMemoryMarker) {
 			if((address & 0x3FFF) >= 0x3F00) {
-				info->WatchedAddressValues[address] = ReadPaletteRam(address);
+				info->WatchedAddressValues[i] = ReadPaletteRam(address);
 			} else {
-				info->WatchedAddressValues[address] = _console->GetMapper()->DebugReadVram(address & 0x3FFF, true);
+				info->WatchedAddressValues[i] = _console->GetMapper()->DebugReadVram(address & 0x3FFF, true);
 			}
 		} else {
-			info->WatchedAddressValues[address] = _console->GetMemoryManager()->DebugRead(address);
+			info->WatchedAddressValues[i] = _console->GetMemoryManager()->DebugRead(address);
 		}
 	}
 
@@ -69,12 +69,18 @@ struct HdPackBaseMemoryCondition : public HdPackCondition
 	uint32_t OperandB = 0;
 	uint8_t Mask = 0;
 
-	void Initialize(uint32_t operandA, HdPackConditionOperator op, uint32_t operandB, uint8_t mask)
+	//Indexes of the operands in HdScreenInfo::WatchedAddressValues
+	uint32_t OperandAIndex = 0;
+	uint32_t OperandBIndex = 0;
+
+	void Initialize(uint32_t operandA, HdPackConditionOperator op, uint32_t operandB, uint8_t mask, uint32_t operandAIndex, uint32_t operandBIndex)
 	{
 		OperandA = operandA;
 		Operator = op;
 		OperandB = operandB;
 		Mask = mask;
+		OperandAIndex = operandAIndex;
+		OperandBIndex = operandBIndex;
 	}
 
 	bool IsPpuCondition()
@@ -235,8 +241,8 @@ struct HdPackMemoryCheckCondition : public HdPackBaseMemoryCondition
 
 	bool InternalCheckCondition(int x, int y, HdPpuTileInfo* tile) override
 	{
-		uint8_t a = (uint8_t)(_screenInfo->WatchedAddressValues[OperandA] & Mask);
-		uint8_t b = (uint8_t)(_screenInfo->WatchedAddressValues[OperandB] & Mask);
+		uint8_t a = (uint8_t)(_screenInfo->WatchedAddressValues[OperandAIndex] & Mask);
+		uint8_t b = (uint8_t)(_screenInfo->WatchedAddressValues[OperandBIndex] & Mask);
 
 		switch(Operator) {
 			case HdPackConditionOperator::Equal: return a == b;
@@ -258,7 +264,7 @@ struct HdPackMemoryCheckConstantCondition : public HdPackBaseMemoryCondition
 
 	bool InternalCheckCondition(int x, int y, HdPpuTileInfo* tile) override
 	{
-		uint8_t a = (uint8_t)(_screenInfo->WatchedAddressValues[OperandA] & Mask);
+		uint8_t a = (uint8_t)(_screenInfo->WatchedAddressValues[OperandAIndex] & Mask);
 		uint8_t b = OperandB;
 
 		switch(Operator) {
@@ -252,6 +252,15 @@ bool HdPackLoader::ProcessImgTag(string src)
 	return true;
 }
 
+uint32_t HdPackLoader::GetWatchedAddressIndex(uint32_t address)
+{
+	auto result = _watchedAddressIndexes.emplace(address, (uint32_t)_data->WatchedMemoryAddresses.size());
+	if(result.second) {
+		_data->WatchedMemoryAddresses.push_back(address);
+	}
+	return result.first->second;
+}
+
 template<typename T>
 void HdPackLoader::AddGlobalCondition(string name) {
 	T* cond = new T();
@@ -532,6 +541,7 @@ void HdPackLoader::ProcessConditionTag(vector<string> &tokens, bool createInvert
 				mask = HexUtilities::FromHex(tokens[index++]);
 			}
 
+			uint32_t operandBIndex = 0;
 			switch(condition->GetConditionType()) {
 				case HdPackConditionType::MemoryCheck:
 					if(usePpuMemory) {
@@ -540,7 +550,7 @@ void HdPackLoader::ProcessConditionTag(vector<string> &tokens, bool createInvert
 					} else {
 						checkConstraint(operandB <= 0xFFFF, "[HDPack] Out of range memoryCheck operand");
 					}
-					_data->WatchedMemoryAddresses.emplace(operandB);
+					operandBIndex = GetWatchedAddressIndex(operandB);
 					break;
 
 				case HdPackConditionType::MemoryCheckConstant:
@@ -548,8 +558,8 @@ void HdPackLoader::ProcessConditionTag(vector<string> &tokens, bool createInvert
 					break;
 			}
 
-			_data->WatchedMemoryAddresses.emplace(operandA);
-			((HdPackBaseMemoryCondition*)condition.get())->Initialize(operandA, op, operandB, (uint8_t)mask);
+			uint32_t operandAIndex = GetWatchedAddressIndex(operandA);
+			((HdPackBaseMemoryCondition*)condition.get())->Initialize(operandA, op, operandB, (uint8_t)mask, operandAIndex, operandBIndex);
 			break;
 		}
 
@@ -20,6 +20,7 @@ private:
 	string _hdPackFolder;
 	unordered_map<string, HdPackCondition*> _conditionsByName;
 	unordered_map<string, HdPackBitmapInfo*> _backgroundsByName;
+	unordered_map<uint32_t, uint32_t> _watchedAddressIndexes;
 
 	HdPackLoader();
 
@@ -54,4 +55,5 @@ private:
 	void ProcessSfxTag(vector<string> &tokens);
 
 	vector<HdPackCondition*> ParseConditionString(string conditionString);
+	uint32_t GetWatchedAddressIndex(uint32_t address);
 };
\ No newline at end of file
@@ -2,15 +2,17 @@
 #include "NES/HdPacks/OggReader.h"
 #include "Utilities/Audio/stb_vorbis.h"
 
-OggReader::OggReader()
+//Positions are sample numbers, as expected by stb_vorbis_seek
+OggReader::OggReader() : AudioStream(1)
 {
 	_done = false;
-	_oggBuffer = new int16_t[10000];
+	_oggBuffer = new int16_t[OggBufferSize * 2];
 	_outputBuffer = new int16_t[2000];
 }
 
 OggReader::~OggReader()
 {
+	StopStream();
 	delete[] _oggBuffer;
 	delete[] _outputBuffer;
 
@@ -21,13 +23,14 @@ OggReader::~OggReader()
 
 bool OggReader::Init(string filename, bool loop, uint32_t sampleRate, uint32_t startOffset, uint32_t loopPosition)
 {
+	auto lock = _decodeLock.AcquireSafe();
+
 	int error;
 	VirtualFile file = filename;
 	_fileData = vector<uint8_t>(100000);
 	if(file.ReadFile(_fileData)) {
 		_vorbis = stb_vorbis_open_memory(_fileData.data(), (int)_fileData.size(), &error, nullptr);
 		if(_vorbis) {
-			_loop = loop;
 			if(loopPosition > 0) {
 				unsigned int sampleCount = stb_vorbis_stream_length_in_samples(_vorbis);
 				_loopPosition = loopPosition < sampleCount ? loopPosition : 0;
@@ -38,6 +41,8 @@ bool OggReader::Init(string filename, bool loop, uint32_t sampleRate, uint32_t s
 			if(startOffset > 0) {
 				stb_vorbis_seek(_vorbis, startOffset);
 			}
+			_decodePosition = startOffset;
+			StartStream(loop, startOffset);
 			return true;
 		}
 	}
@@ -56,9 +61,23 @@ void OggReader::SetSampleRate(int sampleRate)
 	}
 }
 
-void OggReader::SetLoopFlag(bool loop)
+uint32_t OggReader::Decode(int16_t* out, uint32_t frameCount)
+{
+	uint32_t samplesLoaded = (uint32_t)stb_vorbis_get_samples_short_interleaved(_vorbis, 2, out, frameCount * 2);
+	_decodePosition += samplesLoaded;
+	return samplesLoaded;
+}
+
+bool OggReader::SeekToLoopPoint()
+{
+	_decodePosition = _loopPosition;
+	return stb_vorbis_seek(_vorbis, _loopPosition) != 0;
+}
+
+void OggReader::Seek(uint32_t position)
 {
-	_loop = loop;
+	_decodePosition = position;
+	stb_vorbis_seek(_vorbis, position);
 }
 
 void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume)
@@ -66,16 +85,9 @@ void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume
 	int32_t samplesNeeded = (int32_t)sampleCount - _resampler.GetPendingCount();
 	uint32_t samplesRead = 0;
 	if(samplesNeeded > 0) {
-		uint32_t samplesToLoad = samplesNeeded * _oggSampleRate / _sampleRate + 2;
-		uint32_t samplesLoaded = (uint32_t)stb_vorbis_get_samples_short_interleaved(_vorbis, 2, _oggBuffer, samplesToLoad * 2);
-		if(samplesLoaded < samplesToLoad) {
-			if(_loop) {
-				stb_vorbis_seek(_vorbis, _loopPosition);
-				samplesLoaded += stb_vorbis_get_samples_short_interleaved(_vorbis, 2, _oggBuffer + samplesLoaded * 2, (samplesToLoad - samplesLoaded) * 2);
-			} else {
-				_done = true;
-			}
-		}
+		uint32_t samplesToLoad = std::min(samplesNeeded * _oggSampleRate / _sampleRate + 2, (int)OggBufferSize);
+		uint32_t samplesLoaded = ReadFrames(_oggBuffer, samplesToLoad);
+		_done = IsEndOfStream();
 		_resampler.SetSampleRates(_oggSampleRate, _sampleRate);
 		samplesRead = _resampler.Resample<false>(_oggBuffer, samplesLoaded, _outputBuffer, sampleCount);
 	}
@@ -85,8 +97,3 @@ void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume
 		buffer[i] = std::clamp<int32_t>((int32_t)(_outputBuffer[i] * volume / 255) + buffer[i], INT16_MIN, INT16_MAX);
 	}
 }
-
-uint32_t OggReader::GetOffset()
-{
-	return stb_vorbis_get_file_offset(_vorbis);
-}
\ No newline at end of file
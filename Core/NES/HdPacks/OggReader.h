@@ -1,29 +1,38 @@
 #pragma once
 #include "pch.h"
+#include "Shared/Audio/AudioStream.h"
 #include "Utilities/VirtualFile.h"
 #include "Utilities/Audio/HermiteResampler.h"
 
 struct stb_vorbis;
 
-class OggReader
+class OggReader final : public AudioStream
 {
 private:
+	static constexpr uint32_t OggBufferSize = 5000; //stereo frames
+
 	stb_vorbis* _vorbis = nullptr;
 	int16_t* _outputBuffer = nullptr;
 	int16_t* _oggBuffer = nullptr;
 
 	HermiteResampler _resampler;
 
-	bool _loop = false;
 	bool _done = false;
 	
 	uint32_t _loopPosition = 0;
+	uint32_t _decodePosition = 0;
 
 	int _sampleRate = 0;
 	int _oggSampleRate = 0;
 
 	vector<uint8_t> _fileData;
 
+protected:
+	uint32_t Decode(int16_t* out, uint32_t frameCount) override;
+	bool SeekToLoopPoint() override;
+	void Seek(uint32_t position) override;
+	uint32_t GetDecodePosition() override { return _decodePosition; }
+
 public:
 	OggReader();
 	~OggReader();
@@ -31,7 +40,5 @@ public:
 	bool Init(string filename, bool loop, uint32_t sampleRate, uint32_t startOffset = 0, uint32_t loopPosition = 0);
 	bool IsPlaybackOver();
 	void SetSampleRate(int sampleRate);
-	void SetLoopFlag(bool loop);
 	void ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume);
-	uint32_t GetOffset();
 };
@@ -31,6 +31,10 @@ void Fds::InitMapper()
 	_cpu = _console->GetCpu();
 	_memoryManager = _console->GetMemoryManager();
 
+	//ReadRam monitors BIOS reads at $E18C and $E445 (auto disk insert)
+	AddReadSideEffectRange(0xE100, 0xE1FF);
+	AddReadSideEffectRange(0xE400, 0xE4FF);
+
 	//FDS BIOS
 	SetCpuMemoryMapping(0xE000, 0xFFFF, 0, PrgMemoryType::PrgRom, MemoryAccessType::Read);
 
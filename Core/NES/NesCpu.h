@@ -32,8 +32,8 @@ private:
 	uint8_t _endClockCount;
 	uint16_t _operand;
 
-	Func _opTable[256];
-	NesAddrMode _addrMode[256];
+	static Func const _opTable[256];
+	static NesAddrMode const _addrMode[256];
 	NesAddrMode _instAddrMode;
 
 	bool _needHalt = false;
@@ -65,6 +65,8 @@ private:
 	__forceinline void ProcessPendingDma(uint16_t readAddress);
 	uint8_t ProcessDmaRead(uint16_t addr, uint16_t& prevReadAddress, bool enableInternalRegReads, bool isNesBehavior);
 	__forceinline uint16_t FetchOperand();
+	void DispatchOpCode(uint8_t opCode);
+	template<NesAddrMode mode, Func op> __forceinline void ExecOp();
 	__forceinline void EndCpuCycle(bool forRead);
 	void IRQ();
 
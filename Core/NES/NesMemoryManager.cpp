@@ -14,6 +14,7 @@ NesMemoryManager::NesMemoryManager(NesConsole* console, BaseMapper* mapper)
 	_emu = console->GetEmulator();
 	_cheatManager = _emu->GetCheatManager();
 	_mapper = mapper;
+	_mapperReadPages = mapper->GetDirectReadPages();
 
 	_internalRamSize = mapper->GetInternalRamSize();
 	_internalRam = new uint8_t[_internalRamSize];
@@ -73,6 +74,7 @@ void NesMemoryManager::RegisterIODevice(INesMemoryHandler*handler)
 
 	InitializeMemoryHandlers(_ramReadHandlers, handler, ranges.GetRAMReadAddresses(), ranges.GetAllowOverride());
 	InitializeMemoryHandlers(_ramWriteHandlers, handler, ranges.GetRAMWriteAddresses(), ranges.GetAllowOverride());
+	UpdateDirectReadPages();
 }
 
 void NesMemoryManager::RegisterWriteHandler(INesMemoryHandler* handler, uint32_t start, uint32_t end)
@@ -94,6 +96,19 @@ void NesMemoryManager::UnregisterIODevice(INesMemoryHandler*handler)
 	for(uint16_t address : *ranges.GetRAMWriteAddresses()) {
 		_ramWriteHandlers[address] = &_openBusHandler;
 	}
+	UpdateDirectReadPages();
+}
+
+void NesMemoryManager::UpdateDirectReadPages()
+{
+	//A page can only bypass the read handlers if the whole page is handled by internal RAM or by the mapper
+	for(int i = 0; i < 0x100; i++) {
+		INesMemoryHandler* handler = _ramReadHandlers[i << 8];
+		bool isSingleHandler = std::all_of(_ramReadHandlers + (i << 8), _ramReadHandlers + (i << 8) + 0x100, [=](INesMemoryHandler* h) { return h == handler; });
+
+		_internalRamPages[i] = isSingleHandler && handler == _internalRamHandler.get() ? _internalRam + ((i << 8) & (_internalRamSize - 1)) : nullptr;
+		_isMapperPage[i] = isSingleHandler && handler == _mapper;
+	}
 }
 
 uint8_t* NesMemoryManager::GetInternalRam()
@@ -117,7 +132,16 @@ uint16_t NesMemoryManager::DebugReadWord(uint16_t addr)
 
 uint8_t NesMemoryManager::Read(uint16_t addr, MemoryOperationType operationType)
 {
-	uint8_t value = _ramReadHandlers[addr]->ReadRam(addr);
+	uint8_t value;
+	uint8_t page = addr >> 8;
+	if(_internalRamPages[page]) {
+		value = _internalRamPages[page][(uint8_t)addr];
+	} else if(_isMapperPage[page] && _mapperReadPages[page]) {
+		//Plain PRG ROM/RAM page, no need to call the mapper's ReadRam
+		value = _mapperReadPages[page][(uint8_t)addr];
+	} else {
+		value = _ramReadHandlers[addr]->ReadRam(addr);
+	}
 	if(_cheatManager->HasCheats<CpuType::Nes>()) {
 		_cheatManager->ApplyCheat<CpuType::Nes>(addr, value);
 	}
@@ -33,7 +33,13 @@ private:
 	INesMemoryHandler** _ramReadHandlers = nullptr;
 	INesMemoryHandler** _ramWriteHandlers = nullptr;
 
+	//Pages that can be read without going through the read handlers (internal RAM, and PRG pages without side effects)
+	uint8_t* _internalRamPages[0x100] = {};
+	bool _isMapperPage[0x100] = {};
+	uint8_t* const* _mapperReadPages = nullptr;
+
 	void InitializeMemoryHandlers(INesMemoryHandler** memoryHandlers, INesMemoryHandler* handler, vector<uint16_t>* addresses, bool allowOverride);
+	void UpdateDirectReadPages();
 
 protected:
 	void Serialize(Serializer& s) override;
@@ -125,6 +125,7 @@ public:
 	void UpdateTimings(ConsoleRegion region, bool overclockAllowed = true) override;
 
 	__forceinline void Exec();
+	__forceinline uint32_t GetIdleCycleCount(uint64_t runTo);
 	void Run(uint64_t runTo) override;
 
 	uint32_t GetPixelBrightness(uint8_t x, uint8_t y) override;
@@ -135,10 +136,33 @@ public:
 	}
 };
 
+template<class T>
+uint32_t NesPpu<T>::GetIdleCycleCount(uint64_t runTo)
+{
+	//During vertical blank (outside of the NMI dot and PAL's OAM refresh), Exec() only increments the cycle counter,
+	//so these dots can be skipped as a block, up to the end of the scanline (exclusive of the last dot to run)
+	if(_scanline < 240 || _needStateUpdate || (_scanline == _nmiScanline && _cycle == 0) || _emu->IsDebugging()) {
+		return 0;
+	} else if(_region == ConsoleRegion::Pal && _scanline >= _palSpriteEvalScanline) {
+		return 0;
+	}
+
+	uint64_t cyclesToRun = (runTo - _masterClock) / _masterClockDivider;
+	if(cyclesToRun <= 1) {
+		return 0;
+	}
+	return (uint32_t)std::min<uint64_t>(cyclesToRun - 1, 340 - _cycle);
+}
+
 template<class T>
 void NesPpu<T>::Run(uint64_t runTo)
 {
 	do {
+		if(uint32_t idleCycles = GetIdleCycleCount(runTo)) {
+			_cycle += idleCycles;
+			_masterClock += idleCycles * _masterClockDivider;
+		}
+
 		//Always need to run at least once, check condition at the end of the loop (slightly faster)
 		Exec();
 		_masterClock += _masterClockDivider;
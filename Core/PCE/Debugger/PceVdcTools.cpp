@@ -105,6 +105,7 @@ DebugTilemapInfo PceVdcTools::InternalGetTilemap(GetTilemapOptions options, PceV
 		}
 	}
 
+	TileRowDecoder<format> decoder;
 	for(uint8_t row = 0; row < state.RowCount; row++) {
 		for(uint8_t column = 0; column < state.ColumnCount; column++) {
 			uint16_t entryAddr = (row * state.ColumnCount + column) * 2;
@@ -115,7 +116,7 @@ DebugTilemapInfo PceVdcTools::InternalGetTilemap(GetTilemapOptions options, PceV
 			for(int y = 0; y < 8; y++) {
 				uint16_t tileAddr = tileIndex * 32 + y * 2;
 				for(int x = 0; x < 8; x++) {
-					uint8_t color = GetTilePixelColor<format>(vram, 0xFFFF, tileAddr, x);
+					uint8_t color = decoder.GetPixelColor(vram, 0xFFFF, tileAddr, x);
 					uint16_t palAddr = color == 0 ? 0 : (palIndex * 16 + color);
 					uint32_t outPos = (row * 8 + y) * state.ColumnCount * 8 + column * 8 + x;
 					outBuffer[outPos] = palette[palAddr & colorMask];
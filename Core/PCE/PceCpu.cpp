@@ -8,7 +8,7 @@
 #include "Utilities/RandomHelper.h"
 
 typedef PceCpu C;
-PceCpu::Func const PceCpu::_opTable[] = {
+constexpr PceCpu::Func PceCpu::_opTable[] = {
 	//	0		1			2			3			4			5			6						7				8			9			A					B			C					D			E						F
 	&C::BRK,	&C::ORA,	&C::SXY,	&C::ST0,	&C::TSB,	&C::ORA,	&C::ASL_Memory,	&C::RMB0,	&C::PHP,	&C::ORA,	&C::ASL_Acc,	&C::NOP,	&C::TSB,			&C::ORA,	&C::ASL_Memory,	&C::BBR0, //0
 	&C::BPL,	&C::ORA,	&C::ORA,	&C::ST1,	&C::TRB,	&C::ORA,	&C::ASL_Memory,	&C::RMB1,	&C::CLC,	&C::ORA,	&C::INC_Acc,	&C::NOP,	&C::TRB,			&C::ORA,	&C::ASL_Memory,	&C::BBR1, //1
@@ -29,7 +29,7 @@ PceCpu::Func const PceCpu::_opTable[] = {
 };
 
 typedef PceAddrMode M;
-PceAddrMode const PceCpu::_addrMode[] = {
+constexpr PceAddrMode PceCpu::_addrMode[] = {
 //	0			1				2			3				4				5				6				7				8			9			A			B			C				D			E			F
 	M::Imm,	M::IndX,		M::Imp,	M::Imm,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imp,	M::Abs,		M::Abs,	M::Abs,	M::ZeroRel,	//0
 	M::Rel,	M::IndY,		M::ZInd,	M::Imm,		M::Zero,		M::ZeroX,	M::ZeroX,	M::Zero,		M::Imp,	M::AbsY,	M::Imp,	M::Imp,	M::Abs,		M::AbsX,	M::AbsX,	M::ZeroRel,//1
@@ -101,10 +101,7 @@ void PceCpu::Exec()
 	_memoryFlag = CheckFlag(PceCpuFlags::Memory);
 	ClearFlags(PceCpuFlags::Memory);
 
-	uint8_t opCode = GetOPCode();
-	_instAddrMode = _addrMode[opCode];
-	FetchOperand();
-	(this->*_opTable[opCode])();
+	DispatchOpCode(GetOPCode());
 
 	if(_pendingIrqs || _memoryManager->HasIrqSource(PceIrqSource::TimerIrq)) {
 		ProcessIrq(false);
@@ -171,6 +168,38 @@ void PceCpu::FetchOperand()
 	}
 }
 
+template<PceAddrMode mode, PceCpu::Func op>
+void PceCpu::ExecOp()
+{
+	_instAddrMode = mode;
+	FetchOperand();
+	(this->*op)();
+}
+
+void PceCpu::DispatchOpCode(uint8_t opCode)
+{
+#ifdef CPU_TABLE_DISPATCH
+	_instAddrMode = _addrMode[opCode];
+	FetchOperand();
+	(this->*_opTable[opCode])();
+#else
+	//Each case fuses the addressing mode and the instruction into a single function, which
+	//lets the compiler inline the addressing mode and call the instruction directly
+	//The cases are generated from the _opTable/_addrMode tables above, so they can't get out of sync
+	#define OP(i) case (i): ExecOp<_addrMode[(i)], _opTable[(i)]>(); break;
+	#define OP4(i) OP(i) OP((i)+1) OP((i)+2) OP((i)+3)
+	#define OP16(i) OP4(i) OP4((i)+4) OP4((i)+8) OP4((i)+12)
+	#define OP64(i) OP16(i) OP16((i)+16) OP16((i)+32) OP16((i)+48)
+	switch(opCode) {
+		OP64(0x00) OP64(0x40) OP64(0x80) OP64(0xC0)
+	}
+	#undef OP64
+	#undef OP16
+	#undef OP4
+	#undef OP
+#endif
+}
+
 void PceCpu::SetRegister(uint8_t& reg, uint8_t value)
 {
 	ClearFlags(PceCpuFlags::Zero | PceCpuFlags::Negative);
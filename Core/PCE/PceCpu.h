@@ -230,6 +230,8 @@ private:
 	void SMB(uint8_t bit);
 	
 	__forceinline void FetchOperand();
+	void DispatchOpCode(uint8_t opCode);
+	template<PceAddrMode mode, Func op> __forceinline void ExecOp();
 
 	void SetRegister(uint8_t& reg, uint8_t value);
 
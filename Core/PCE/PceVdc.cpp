@@ -450,6 +450,7 @@ void PceVdc::LoadBackgroundTilesWidth4(uint16_t end, uint16_t scrollOffset, uint
 				//Load CG0 or CG1 based on CG mode flag
 				_tiles[_tileCount].TileData[0] = ReadVram(_tiles[_tileCount].TileAddr + (row & 0x07) + (_state.CgMode ? 8 : 0));
 				_tiles[_tileCount].TileData[1] = 0;
+				_tiles[_tileCount].Pixels = DecodeTilePixels(_tiles[_tileCount].TileData[0], 0);
 				_tileCount++;
 				break;
 		}
@@ -468,12 +469,14 @@ void PceVdc::LoadBatEntry(uint16_t scrollOffset, uint16_t columnMask, uint16_t r
 void PceVdc::LoadTileDataCg0(uint16_t row)
 {
 	_tiles[_tileCount].TileData[0] = ReadVram(_tiles[_tileCount].TileAddr + (row & 0x07));
+	_tiles[_tileCount].Pixels = DecodeTilePixels(_tiles[_tileCount].TileData[0], _tiles[_tileCount].TileData[1]);
 	_allowVramAccess = false;
 }
 
 void PceVdc::LoadTileDataCg1(uint16_t row)
 {
 	_tiles[_tileCount].TileData[1] = ReadVram(_tiles[_tileCount].TileAddr + (row & 0x07) + 8);
+	_tiles[_tileCount].Pixels = DecodeTilePixels(_tiles[_tileCount].TileData[0], _tiles[_tileCount].TileData[1]);
 	_allowVramAccess = false;
 	_tileCount++;
 }
@@ -523,6 +526,7 @@ void PceVdc::LoadSpriteTiles()
 			spr.TileData[1] = ReadVram(addr + 16);
 			spr.TileData[2] = ReadVram(addr + 32);
 			spr.TileData[3] = ReadVram(addr + 48);
+			spr.Pixels = DecodeSpritePixels(spr.TileData);
 			hasSprite0 |= spr.Index == 0;
 		}
 	} else {
@@ -539,6 +543,7 @@ void PceVdc::LoadSpriteTiles()
 			spr.TileData[1] = ReadVram(addr + 16);
 			spr.TileData[2] = 0;
 			spr.TileData[3] = 0;
+			spr.Pixels = DecodeSpritePixels(spr.TileData);
 			hasSprite0 |= spr.Index == 0;
 		}
 	}
@@ -766,22 +771,37 @@ void PceVdc::ProcessEndOfVisibleFrame()
 	_needVertBlankIrq = false;
 }
 
-uint8_t PceVdc::GetTilePixelColor(const uint16_t chr0, const uint16_t chr1, const uint8_t shift)
+uint32_t PceVdc::SpreadBits(const uint8_t value)
 {
-	uint16_t color = ((chr0 >> shift) & 0x101) | (((chr1 >> shift) & 0x101) << 2);
-	return (uint8_t)(color | ((color & 0x500) >> 7));
+	//Moves bit N to bit N*4, to convert a planar byte into 8 packed 4-bit pixels
+	uint32_t bits = value;
+	bits = (bits | (bits << 12)) & 0x000F000F;
+	bits = (bits | (bits << 6)) & 0x03030303;
+	bits = (bits | (bits << 3)) & 0x11111111;
+	return bits;
 }
 
-uint8_t PceVdc::GetSpritePixelColor(const uint16_t chrData[4], const uint8_t shift)
+uint32_t PceVdc::DecodeTilePixels(const uint16_t chr0, const uint16_t chr1)
 {
+	//Decode all 8 pixels of the tile row at once when it is loaded, rather than once per pixel drawn
 	return (
-		((chrData[0] >> shift) & 0x01) |
-		(((chrData[1] >> shift) & 0x01) << 1) |
-		(((chrData[2] >> shift) & 0x01) << 2) |
-		(((chrData[3] >> shift) & 0x01) << 3)
+		SpreadBits((uint8_t)chr0) |
+		(SpreadBits(chr0 >> 8) << 1) |
+		(SpreadBits((uint8_t)chr1) << 2) |
+		(SpreadBits(chr1 >> 8) << 3)
 	);
 }
 
+uint64_t PceVdc::DecodeSpritePixels(const uint16_t chrData[4])
+{
+	uint64_t pixels = 0;
+	for(int i = 0; i < 4; i++) {
+		uint64_t plane = SpreadBits((uint8_t)chrData[i]) | ((uint64_t)SpreadBits(chrData[i] >> 8) << 32);
+		pixels |= plane << i;
+	}
+	return pixels;
+}
+
 void PceVdc::DrawScanline()
 {
 	if(_state.Scanline < 14 || _state.Scanline >= 256) {
@@ -839,7 +859,7 @@ void PceVdc::InternalDrawScanline()
 				if(bgEnabled) {
 					uint16_t screenX = (_state.HvLatch.BgScrollX & 0x07) + _screenOffsetX;
 					uint16_t column = screenX >> 3;
-					bgColor = GetTilePixelColor(_tiles[column].TileData[0], _tiles[column].TileData[1], 7 - (screenX & 0x07));
+					bgColor = (_tiles[column].Pixels >> ((7 - (screenX & 0x07)) * 4)) & 0x0F;
 					if(bgColor != 0) {
 						outColor = _vce->GetPalette(_tiles[column].Palette * 16 + bgColor);
 					}
@@ -857,7 +877,7 @@ void PceVdc::InternalDrawScanline()
 								xOffset = 15 - xOffset;
 							}
 
-							sprColor = GetSpritePixelColor(_drawSprites[i].TileData, xOffset);
+							sprColor = (_drawSprites[i].Pixels >> (xOffset * 4)) & 0x0F;
 
 							if(sprColor != 0) {
 								if constexpr(hasSprite0) {
@@ -1391,6 +1411,9 @@ void PceVdc::Serialize(Serializer& s)
 			SVI(_drawSprites[i].Palette);
 			SVI(_drawSprites[i].HorizontalMirroring);
 			SVI(_drawSprites[i].ForegroundPriority);
+			if(!s.IsSaving()) {
+				_drawSprites[i].Pixels = DecodeSpritePixels(_drawSprites[i].TileData);
+			}
 		}
 
 		for(int i = 0; i < _tileCount; i++) {
@@ -1398,6 +1421,9 @@ void PceVdc::Serialize(Serializer& s)
 			SVI(_tiles[i].TileData[1]);
 			SVI(_tiles[i].Palette);
 			SVI(_tiles[i].TileAddr);
+			if(!s.IsSaving()) {
+				_tiles[i].Pixels = DecodeTilePixels(_tiles[i].TileData[0], _tiles[i].TileData[1]);
+			}
 		}
 	}
 }
@@ -38,6 +38,7 @@ enum class PceVdcEvent
 struct PceTileInfo
 {
 	uint16_t TileData[2];
+	uint32_t Pixels; //Decoded 4-bit colors, pixel N (from the right) in bits N*4 to N*4+3
 	uint16_t TileAddr;
 	uint8_t Palette;
 };
@@ -45,6 +46,7 @@ struct PceTileInfo
 struct PceSpriteInfo
 {
 	uint16_t TileData[4];
+	uint64_t Pixels; //Decoded 4-bit colors, pixel N (from the right) in bits N*4 to N*4+3
 	int16_t X;
 	uint16_t TileAddress;
 	uint8_t Index;
@@ -160,8 +162,9 @@ private:
 	__noinline void ProcessHorizontalSyncStart();
 	__noinline void ProcessVerticalSyncStart();
 
-	__forceinline uint8_t GetTilePixelColor(const uint16_t chr0, const uint16_t chr1, const uint8_t shift);
-	__forceinline uint8_t GetSpritePixelColor(const uint16_t chrData[4], const uint8_t shift);
+	__forceinline static uint32_t SpreadBits(const uint8_t value);
+	__forceinline static uint32_t DecodeTilePixels(const uint16_t chr0, const uint16_t chr1);
+	__forceinline static uint64_t DecodeSpritePixels(const uint16_t chrData[4]);
 
 	__forceinline void ProcessSpriteEvaluation();
 	__noinline void LoadSpriteTiles();
@@ -46,6 +46,7 @@ DebugTilemapInfo SmsVdpTools::GetTilemap(GetTilemapOptions options, BaseState& b
 		result.ScrollY = state.VerticalScroll + (isGameGear ? 24 : 0);
 		result.TilemapAddress = state.EffectiveNametableAddress;
 
+		TileRowDecoder<TileFormat::SmsBpp4> decoder;
 		for(uint8_t row = 0; row < result.RowCount; row++) {
 			for(uint8_t column = 0; column < 32; column++) {
 				uint16_t entryAddr = state.EffectiveNametableAddress + ((row * 32 + column) * 2);
@@ -62,7 +63,7 @@ DebugTilemapInfo SmsVdpTools::GetTilemap(GetTilemapOptions options, BaseState& b
 					for(int x = 0; x < 8; x++) {
 						uint8_t tileColumn = hMirror ? 7 - (x & 0x07) : (x & 0x07);
 
-						uint8_t color = GetTilePixelColor<TileFormat::SmsBpp4>(vram, 0x3FFF, tileAddr, tileColumn);
+						uint8_t color = decoder.GetPixelColor(vram, 0x3FFF, tileAddr, tileColumn);
 						uint16_t palAddr = color == 0 ? 0 : (paletteOffset + color);
 						uint32_t outPos = (row * 8 + y) * 32 * 8 + column * 8 + x;
 						outBuffer[outPos] = palette[palAddr & colorMask];
@@ -74,6 +75,7 @@ DebugTilemapInfo SmsVdpTools::GetTilemap(GetTilemapOptions options, BaseState& b
 		//TODOSMS text/multicolor modes
 		result.TilemapAddress = state.NametableAddress;
 
+		TileRowDecoder<TileFormat::SmsSgBpp1> decoder;
 		for(uint8_t row = 0; row < result.RowCount; row++) {
 			for(uint8_t column = 0; column < result.ColumnCount; column++) {
 				uint16_t ntAddr = state.NametableAddress + (column + row * 32);
@@ -105,7 +107,7 @@ DebugTilemapInfo SmsVdpTools::GetTilemap(GetTilemapOptions options, BaseState& b
 
 					uint8_t color = vram[colorAddr];
 					for(int x = 0; x < 8; x++) {
-						uint8_t colorBit = GetTilePixelColor<TileFormat::SmsSgBpp1>(vram, 0x3FFF, tileAddr+y, x);
+						uint8_t colorBit = decoder.GetPixelColor(vram, 0x3FFF, tileAddr+y, x);
 						uint8_t pixelColor = colorBit ? (color >> 4) : (color & 0xF);
 						uint32_t outPos = (row * 8 + y) * 32 * 8 + column * 8 + x;
 						outBuffer[outPos] = palette[pixelColor];
@@ -316,15 +318,17 @@ void SmsVdpTools::GetSpriteInfo(DebugSpriteInfo& sprite, uint32_t* spritePreview
 	}
 	sprite.TileAddress = tileStart;
 
+	TileRowDecoder<TileFormat::SmsBpp4> decoder;
+	TileRowDecoder<TileFormat::SmsSgBpp1> sgDecoder;
 	for(int y = 0; y < sprite.Height; y++) {
 		uint16_t pixelStart = tileStart + y * (state.UseMode4 ? 4 : 1);
 
 		for(int x = 0; x < sprite.Width; x++) {
 			uint8_t color;
 			if(state.UseMode4) {
-				color = GetTilePixelColor<TileFormat::SmsBpp4>(vram, 0x3FFF, pixelStart, x);
+				color = decoder.GetPixelColor(vram, 0x3FFF, pixelStart, x);
 			} else {
-				color = GetTilePixelColor<TileFormat::SmsSgBpp1>(vram, 0x3FFF, pixelStart + (x >= 8 ? 16 : 0), x & 0x07);
+				color = sgDecoder.GetPixelColor(vram, 0x3FFF, pixelStart + (x >= 8 ? 16 : 0), x & 0x07);
 			}
 
 			uint32_t outOffset = (y * sprite.Width) + x;
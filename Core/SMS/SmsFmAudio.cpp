@@ -29,13 +29,18 @@ SmsFmAudio::~SmsFmAudio()
 void SmsFmAudio::Run()
 {
 	if(_fmEnabled && _emu->GetSettings()->GetSmsConfig().EnableFmAudio) {
-		uint64_t clocksToRun = _console->GetMasterClock() - _prevMasterClock;
-		while(clocksToRun >= 72) {
-			int16_t output = OPLL_calc(_opll);
-			_samplesToPlay.push_back(output);
-			_samplesToPlay.push_back(output);
-			_prevMasterClock += 72;
-			clocksToRun -= 72;
+		//Generate all samples since the last register write (or the last mix) as a single block
+		uint32_t sampleCount = (uint32_t)((_console->GetMasterClock() - _prevMasterClock) / 72);
+		if(sampleCount > 0) {
+			size_t startIndex = _samplesToPlay.size();
+			_samplesToPlay.resize(startIndex + sampleCount * 2);
+			int16_t* out = _samplesToPlay.data() + startIndex;
+			for(uint32_t i = 0; i < sampleCount; i++) {
+				int16_t output = OPLL_calc(_opll);
+				out[i * 2] = output;
+				out[i * 2 + 1] = output;
+			}
+			_prevMasterClock += sampleCount * 72;
 		}
 	} else {
 		_prevMasterClock = _console->GetMasterClock();
@@ -22,8 +22,9 @@ void SmsVdp::Init(Emulator* emu, SmsConsole* console, SmsCpu* cpu, SmsControlMan
 	_cpu = cpu;
 	_controlManager = controlManager;
 	_memoryManager = memoryManager;
+	_cfg = &emu->GetSettings()->GetSmsConfig();
 
-	_activeSgPalette = _emu->GetSettings()->GetSmsConfig().UseSgPalette ? _originalSgPalette : _smsSgPalette;
+	_activeSgPalette = _cfg->UseSgPalette ? _originalSgPalette : _smsSgPalette;
 
 	_outputBuffers[0] = new uint16_t[256 * 240];
 	_outputBuffers[1] = new uint16_t[256 * 240];
@@ -71,9 +72,33 @@ SmsVdp::~SmsVdp()
 	delete[] _outputBuffers[1];
 }
 
+uint16_t SmsVdp::GetIdleCycleCount(uint64_t runTo)
+{
+	//Outside of the visible part of the scanline and before the end of scanline events (cycle 317+),
+	//Exec() only increments the cycle counter when no VRAM/palette write is pending, so these cycles
+	//can be skipped as a block (exclusive of the last cycle to run)
+	if(_writePending != SmsVdpWriteType::None || _state.Cycle >= 317 || _emu->IsDebugging()) {
+		return 0;
+	} else if(_state.Scanline < _state.VisibleScanlineCount && _state.Cycle < 256 + SmsVdp::SmsVdpLeftBorder) {
+		return 0;
+	}
+
+	if(_lastMasterClock + 3 >= runTo) {
+		return 0;
+	}
+	uint64_t cyclesToRun = (runTo - _lastMasterClock) / 2;
+	return (uint16_t)std::min<uint64_t>(cyclesToRun - 1, 317 - _state.Cycle);
+}
+
 void SmsVdp::Run(uint64_t runTo)
 {
 	do {
+		if(uint16_t idleCycles = GetIdleCycleCount(runTo)) {
+			_state.Cycle += idleCycles;
+			_lastMasterClock += idleCycles * 2;
+			_needCramDot = false;
+		}
+
 		//Always need to run at least once, check condition at the end of the loop (slightly faster)
 		Exec();
 		_lastMasterClock += 2;
@@ -269,7 +294,7 @@ void SmsVdp::LoadBgTilesSms()
 				_bgShifters[3] |= _videoRam[_bgTileAddr + 3] << (16 - _pixelsAvailable);
 			}
 
-			if(_emu->GetSettings()->GetSmsConfig().DisableBackground) {
+			if(_cfg->DisableBackground) {
 				memset(_bgShifters, 0, sizeof(_bgShifters));
 				_bgPriority = 0;
 			}
@@ -337,7 +362,7 @@ void SmsVdp::LoadBgTilesSg()
 				_bgShifters[3] |= ((pixelColor >> 3) & 0x01) << (23 - i - _pixelsAvailable);
 			}
 						
-			if(_emu->GetSettings()->GetSmsConfig().DisableBackground) {
+			if(_cfg->DisableBackground) {
 				memset(_bgShifters, 0, sizeof(_bgShifters));
 				_bgPriority = 0;
 			}
@@ -431,7 +456,7 @@ void SmsVdp::ProcessScanlineEvents()
 				_emu->GetVideoDecoder()->UpdateFrame(frame, rewinding, rewinding);
 
 				_currentOutputBuffer = _currentOutputBuffer == _outputBuffers[0] ? _outputBuffers[1] : _outputBuffers[0];
-				_activeSgPalette = _emu->GetSettings()->GetSmsConfig().UseSgPalette ? _originalSgPalette : _smsSgPalette;
+				_activeSgPalette = _cfg->UseSgPalette ? _originalSgPalette : _smsSgPalette;
 
 				_console->ProcessEndOfFrame();
 				_emu->ProcessEndOfFrame();
@@ -494,7 +519,7 @@ void SmsVdp::LoadSpritesSms()
 		if(scanline >= sprY && scanline < sprY + spriteHeight) {
 			if(_spriteCount >= 8) {
 				_state.SpriteOverflow = true;
-				if(!_emu->GetSettings()->GetSmsConfig().RemoveSpriteLimit) {
+				if(!_cfg->RemoveSpriteLimit) {
 					break;
 				}
 			}
@@ -545,7 +570,7 @@ void SmsVdp::LoadSpritesSg()
 			if(!_state.SpriteOverflow && sgSpriteCount >= 4) {
 				_state.SpriteOverflowIndex = i;
 				_state.SpriteOverflow = true;
-				if(!_emu->GetSettings()->GetSmsConfig().RemoveSpriteLimit) {
+				if(!_cfg->RemoveSpriteLimit) {
 					break;
 				}
 			}
@@ -674,7 +699,7 @@ uint16_t SmsVdp::GetPixelColor()
 	);
 
 	bool highPriority = (_bgPriority & 0x800000);
-	if(!spriteDrawn || (highPriority && color != 0) || _emu->GetSettings()->GetSmsConfig().DisableSprites) {
+	if(!spriteDrawn || (highPriority && color != 0) || _cfg->DisableSprites) {
 		uint8_t paletteOffset = (_bgPalette & 0x800000) ? 0x10 : 0;
 		if(_state.UseMode4) {
 			return _internalPaletteRam[paletteOffset + color];
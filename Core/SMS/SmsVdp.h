@@ -22,6 +22,7 @@ private:
 	SmsCpu* _cpu = nullptr;
 	SmsControlManager* _controlManager = nullptr;
 	SmsMemoryManager* _memoryManager = nullptr;
+	SmsConfig* _cfg = nullptr;
 
 	uint8_t* _videoRam = nullptr;
 	uint16_t _internalPaletteRam[0x20] = {};
@@ -90,6 +91,7 @@ private:
 	uint8_t ReverseBitOrder(uint8_t val);
 	
 	__forceinline void Exec();
+	__forceinline uint16_t GetIdleCycleCount(uint64_t runTo);
 	__forceinline void ProcessVramWrite();
 	__forceinline int GetVisiblePixelIndex();
 	__forceinline void LoadBgTilesSms();
@@ -878,6 +878,9 @@ void BaseCartridge::RunCoprocessors()
 	//These coprocessors are run at the end of the frame, or as needed
 	if(_necDsp) {
 		_necDsp->Run();
+	} else if(_needCoprocSync) {
+		//Catch up coprocessors that use lazy synchronization (GSU, CX4)
+		_coprocessor->Run();
 	}
 }
 
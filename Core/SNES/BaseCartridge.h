@@ -134,7 +134,7 @@ public:
 	__forceinline void SyncCoprocessors()
 	{
 		if(_needCoprocSync) {
-			_coprocessor->Run();
+			_coprocessor->SyncWithCpu();
 		}
 	}
 
@@ -12,6 +12,11 @@ public:
 	virtual void Reset() = 0;
 
 	virtual void Run() { }	
+
+	//Called by the memory manager after each step of the master clock. By default the coprocessor is kept in sync
+	//with the CPU, but coprocessors that only interact with the CPU through their own memory handlers can instead
+	//catch up (by calling Run) when those are accessed, or when BaseCartridge::RunCoprocessors is called
+	virtual void SyncWithCpu() { Run(); }
 	virtual void ProcessEndOfFrame() { }
 	virtual void LoadBattery() { }
 	virtual void SaveBattery() { }
@@ -106,6 +106,15 @@ void Cx4::Run()
 	}
 }
 
+void Cx4::SyncWithCpu()
+{
+	//While the CX4 is stopped and has no pending bus operation, running it only increments its cycle counter.
+	//In that case, it is left behind and catches up the next time the CPU accesses its registers.
+	if(!IsIdle() || _emu->IsDebugging()) {
+		Run();
+	}
+}
+
 void Cx4::Step(uint64_t cycles)
 {
 	if(_state.Bus.Enabled) {
@@ -281,6 +290,11 @@ void Cx4::WriteCx4(uint32_t addr, uint8_t value)
 
 uint8_t Cx4::Read(uint32_t addr)
 {
+	if(IsIdle()) {
+		//Catch up before the CPU reads the CX4's state (can't be called from within Run() while idle)
+		Run();
+	}
+
 	addr = 0x7000 | (addr & 0xFFF);
 	if(addr <= 0x7BFF) {
 		return _dataRam[addr & 0xFFF];
@@ -325,6 +339,10 @@ uint8_t Cx4::Read(uint32_t addr)
 
 void Cx4::Write(uint32_t addr, uint8_t value)
 {
+	if(IsIdle()) {
+		Run();
+	}
+
 	addr = 0x7000 | (addr & 0xFFF);
 
 	if(addr <= 0x7BFF) {
@@ -429,6 +447,11 @@ bool Cx4::IsBusy()
 	return _state.Cache.Enabled || _state.Dma.Enabled || _state.Bus.DelayCycles > 0;
 }
 
+bool Cx4::IsIdle()
+{
+	return _state.Stopped && !_state.Locked && !_state.Suspend.Enabled && !_state.Bus.Enabled && !IsBusy();
+}
+
 void Cx4::Serialize(Serializer &s)
 {
 	SV(_state.CycleCount); SV(_state.PB); SV(_state.PC); SV(_state.A); SV(_state.P); SV(_state.SP); SV(_state.Mult); SV(_state.RomBuffer);
@@ -33,6 +33,7 @@ private:
 	void Step(uint64_t cycles);
 	bool IsRunning();
 	bool IsBusy();
+	bool IsIdle();
 
 	uint8_t GetAccessDelay(uint32_t addr);
 	uint8_t ReadCx4(uint32_t addr);
@@ -117,6 +118,7 @@ public:
 	void Reset() override;
 
 	void Run() override;
+	void SyncWithCpu() override;
 
 	uint8_t Read(uint32_t addr) override;
 	void Write(uint32_t addr, uint8_t value) override;
@@ -37,14 +37,14 @@ Gsu::Gsu(SnesConsole *console, uint32_t gsuRamSize)
 
 	for(uint32_t i = 0; i < _gsuRamSize / 0x1000; i++) {
 		_gsuRamHandlers.push_back(unique_ptr<IMemoryHandler>(new RamHandler(_gsuRam, i * 0x1000, _gsuRamSize, MemoryType::GsuWorkRam)));
-		_gsuCpuRamHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRamHandler(_state, _gsuRamHandlers.back().get())));
+		_gsuCpuRamHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRamHandler(this, _state, _gsuRamHandlers.back().get())));
 	}
 	
 	//CPU mappings
 	MemoryMappings *cpuMappings = _memoryManager->GetMemoryMappings();
 	vector<unique_ptr<IMemoryHandler>> &prgRomHandlers = _console->GetCartridge()->GetPrgRomHandlers();
 	for(unique_ptr<IMemoryHandler> &handler : prgRomHandlers) {
-		_gsuCpuRomHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRomHandler(_state, handler.get())));
+		_gsuCpuRomHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRomHandler(this, _state, handler.get())));
 	}
 
 	//GSU registers in CPU memory space
@@ -99,6 +99,15 @@ void Gsu::Run()
 	}
 }
 
+void Gsu::SyncWithCpu()
+{
+	//The GSU only interacts with the CPU through its registers, ROM/RAM handlers (which call Run() before
+	//any access) and its IRQ signal - it only needs to be kept in sync with the CPU when it can trigger an IRQ
+	if((_state.SFR.Running && !_state.IrqDisabled) || _emu->IsDebugging()) {
+		Run();
+	}
+}
+
 void Gsu::Exec()
 {
 	uint8_t opCode = ReadOpCode();
@@ -462,6 +471,8 @@ void Gsu::Reset()
 
 uint8_t Gsu::Read(uint32_t addr)
 {
+	Run();
+
 	addr &= 0x33FF;
 	if(_state.SFR.Running && addr != 0x3030 && addr != 0x3031 && addr != 0x303B) {
 		//"During GSU operation, only SFR, SCMR, and VCR may be accessed."
@@ -505,6 +516,8 @@ uint8_t Gsu::Read(uint32_t addr)
 
 void Gsu::Write(uint32_t addr, uint8_t value)
 {
+	Run();
+
 	addr &= 0x33FF;
 	if(_state.SFR.Running && addr != 0x3030 && addr != 0x303A) {
 		//"During GSU operation, only SFR, SCMR, and VCR may be accessed."
@@ -160,6 +160,7 @@ public:
 	void SaveBattery() override;
 	
 	void Run() override;
+	void SyncWithCpu() override;
 	void Reset() override;
 
 	uint8_t Read(uint32_t addr) override;
@@ -1,23 +1,33 @@
 #pragma once
 #include "pch.h"
 #include "SNES/IMemoryHandler.h"
+#include "SNES/Coprocessors/BaseCoprocessor.h"
 #include "SNES/Coprocessors/GSU/GsuTypes.h"
 #include "Shared/MemoryType.h"
 
 class GsuRomHandler : public IMemoryHandler
 {
 private:
+	BaseCoprocessor *_gsu;
 	GsuState *_state;
 	IMemoryHandler *_romHandler;
 
 public:
-	GsuRomHandler(GsuState &state, IMemoryHandler *romHandler) : IMemoryHandler(MemoryType::SnesPrgRom)
+	GsuRomHandler(BaseCoprocessor *gsu, GsuState &state, IMemoryHandler *romHandler) : IMemoryHandler(MemoryType::SnesPrgRom)
 	{
 		_romHandler = romHandler;
+		_gsu = gsu;
 		_state = &state;
 	}
 
 	uint8_t Read(uint32_t addr) override
+	{
+		//Catch up the GSU first, the CPU's access depends on whether it's still running
+		_gsu->Run();
+		return InternalRead(addr);
+	}
+
+	uint8_t InternalRead(uint32_t addr)
 	{
 		if(!_state->SFR.Running || !_state->GsuRomAccess) {
 			return _romHandler->Read(addr);
@@ -40,13 +50,13 @@ public:
 
 	uint8_t Peek(uint32_t addr) override
 	{
-		return Read(addr);
+		return InternalRead(addr);
 	}
 
 	void PeekBlock(uint32_t addr, uint8_t *output) override
 	{
 		for(int i = 0; i < 0x1000; i++) {
-			output[i] = Read(i);
+			output[i] = InternalRead(i);
 		}
 	}
 
@@ -60,7 +60,7 @@ void DspVoice::DecodeBrrSample()
 		//"The calculations above are preformed in some higher number of bits, clamped to
 		//16 bits at the end and then clipped to 15 bits. This 15-bit value is the value
 		//output and the value used as S(x-1) or S(x-2) as needed for future filter iterations."
-		_sampleBuffer[_bufferPos + i] = Dsp::Clamp16(s) * 2;
+		SetSample(_bufferPos + i, Dsp::Clamp16(s) * 2);
 		prev2 = prev1;
 		prev1 = _sampleBuffer[_bufferPos + i] >> 1;
 	}
@@ -178,7 +178,10 @@ void DspVoice::UpdateOutput(bool right)
 	//"Load and apply VxVOL[L/R] register."
 	int32_t voiceOut = ((int32_t)_shared->VoiceOutput * (int8_t)ReadReg((DspVoiceRegs)((int)DspVoiceRegs::VolLeft + (int)right))) >> 7;
 
-	voiceOut = voiceOut * (int32_t)_cfg->ChannelVolumes[_voiceIndex] / 100;
+	uint32_t channelVolume = _cfg->ChannelVolumes[_voiceIndex];
+	if(channelVolume != 100) {
+		voiceOut = voiceOut * (int32_t)channelVolume / 100;
+	}
 
 	_shared->OutSamples[(int)right] = Dsp::Clamp16(_shared->OutSamples[(int)right] + voiceOut);
 
@@ -264,7 +267,7 @@ void DspVoice::Step3c()
 	switch(_cfg->InterpolationType) {
 		case DspInterpolationType::Gauss: output = DspInterpolation::Gauss(_interpolationPos, _sampleBuffer, _bufferPos); break;
 		case DspInterpolationType::Cubic: output = DspInterpolation::Cubic(_interpolationPos, _sampleBuffer, _bufferPos); break;
-		case DspInterpolationType::None: output = _sampleBuffer[((_interpolationPos >> 12) + _bufferPos) % 12]; break;
+		case DspInterpolationType::None: output = _sampleBuffer[(_interpolationPos >> 12) + _bufferPos]; break;
 	}
 
 	//"If applicable, replace the current sample with the noise sample."
@@ -392,4 +395,7 @@ void DspVoice::Serialize(Serializer& s)
 	SV(_bufferPos);
 
 	SVArray(_sampleBuffer, 12);
+	if(!s.IsSaving()) {
+		memcpy(_sampleBuffer + 12, _sampleBuffer, 12 * sizeof(int16_t));
+	}
 }
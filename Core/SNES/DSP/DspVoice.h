@@ -29,7 +29,9 @@ private:
 	uint8_t _envOut = 0;
 	uint8_t _bufferPos = 0;
 
-	int16_t _sampleBuffer[12] = {};
+	//12-sample ring buffer, stored twice in a row so that the 4 samples used by
+	//interpolation are always contiguous (no wrapping needed when reading them)
+	int16_t _sampleBuffer[24] = {};
 
 	uint8_t ReadReg(DspVoiceRegs reg) { return _regs[(int)reg]; }
 	void WriteReg(DspVoiceRegs reg, uint8_t value) { _regs[(int)reg] = value; }
@@ -37,6 +39,7 @@ private:
 	void DecodeBrrSample();
 	void ProcessEnvelope();
 	void UpdateOutput(bool right);
+	void SetSample(uint8_t pos, int16_t value) { _sampleBuffer[pos] = value; _sampleBuffer[pos + 12] = value; }
 
 public:
 	void Init(uint8_t voiceIndex, Spc* spc, Dsp* dsp, uint8_t* dspVoiceRegs, SnesConfig* cfg);
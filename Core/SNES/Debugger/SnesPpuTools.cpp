@@ -146,6 +146,7 @@ void SnesPpuTools::RenderTilemap(GetTilemapOptions& options, int rowCount, Layer
 		colorMask = bpp == 2 ? 0x03 : 0x0F;
 	}
 
+	TileRowDecoder<format> decoder;
 	for(int row = 0; row < rowCount; row++) {
 		uint16_t addrVerticalScrollingOffset = layer.DoubleHeight ? ((row & 0x20) << (layer.DoubleWidth ? 6 : 5)) : 0;
 		uint16_t baseOffset = layer.TilemapAddress + addrVerticalScrollingOffset + ((row & 0x1F) << 5);
@@ -170,7 +171,7 @@ void SnesPpuTools::RenderTilemap(GetTilemapOptions& options, int rowCount, Layer
 					uint16_t pixelStart = tileStart + yOffset * 2;
 
 					uint8_t pixelIndex = hMirror ? (7 - (x & 0x07)) : (x & 0x07);
-					uint8_t color = GetTilePixelColor<format>(vram, SnesPpu::VideoRamSize - 1, pixelStart, pixelIndex);
+					uint8_t color = decoder.GetPixelColor(vram, SnesPpu::VideoRamSize - 1, pixelStart, pixelIndex);
 					if(color != 0) {
 						uint8_t paletteIndex = bpp == 8 ? 0 : (vram[addr + 1] >> 2) & 0x07;
 						int pos = ((row * tileHeight) + y) * outputSize.Width + column * tileWidth + x;
@@ -346,6 +347,7 @@ void SnesPpuTools::GetSpriteInfo(DebugSpriteInfo& sprite, uint32_t* spritePrevie
 	uint8_t yOffset;
 	int rowOffset;
 
+	TileRowDecoder<TileFormat::Bpp4> decoder;
 	for(int y = 0; y < sprite.Height; y++) {
 		if(verticalMirror) {
 			int pos;
@@ -383,7 +385,7 @@ void SnesPpuTools::GetSpriteInfo(DebugSpriteInfo& sprite, uint32_t* spritePrevie
 			uint8_t tileIndex = (row << 4) | column;
 			uint16_t tileStart = ((state.OamBaseAddress + (tileIndex << 4) + (useSecondTable ? state.OamAddressOffset : 0)) & 0x7FFF) << 1;
 
-			uint8_t color = GetTilePixelColor<TileFormat::Bpp4>(vram, SnesPpu::VideoRamSize - 1, tileStart + yOffset * 2, xOffset);
+			uint8_t color = decoder.GetPixelColor(vram, SnesPpu::VideoRamSize - 1, tileStart + yOffset * 2, xOffset);
 			if(color != 0) {
 				spritePreview[outOffset] = GetRgbPixelColor<TileFormat::Bpp4>(palette, color, sprite.Palette + 8);
 			} else {
@@ -45,6 +45,7 @@ public:
 	void ProcessAutoJoypad();
 
 	__forceinline void ProcessIrqCounters();
+	__forceinline bool IsIrqCounterIdle(uint16_t hClockEnd);
 
 	uint8_t GetIoPortOutput();
 	void SetNmiFlag(bool nmiFlag);
@@ -87,4 +88,23 @@ void InternalRegisters::ProcessIrqCounters()
 	}
 	_irqLevel = irqLevel;
 	_cpu->SetNmiFlag(_state.EnableNmi & _nmiFlag);
-}
\ No newline at end of file
+}
+
+bool InternalRegisters::IsIrqCounterIdle(uint16_t hClockEnd)
+{
+	//Returns true when ProcessIrqCounters can't change the IRQ state for any dot until hClockEnd (on the current scanline)
+	if(_needIrq > 0 || _irqLevel) {
+		return false;
+	}
+
+	if(_state.EnableVerticalIrq && _ppu->GetRealScanline() != _state.VerticalTimer) {
+		return true;
+	}
+
+	if(_state.EnableHorizontalIrq) {
+		//The dot counter never goes faster than 1 dot per 4 master clocks
+		return _state.HorizontalTimer > 339 || hClockEnd < _state.HorizontalTimer * 4 || _ppu->GetCycle() > _state.HorizontalTimer;
+	}
+
+	return !_state.EnableVerticalIrq;
+}
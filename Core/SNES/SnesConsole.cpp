@@ -59,6 +59,9 @@ void SnesConsole::RunFrame()
 {
 	UpdateRegion();
 
+	//Coprocessors can modify memory or change the values they return behind the CPU's back, which breaks idle loop detection
+	_cpu->SetIdleLoopSkip(_settings->GetSnesConfig().EnableIdleLoopSkip && !_cart->GetCoprocessor());
+
 	_frameRunning = true;
 
 	while(_frameRunning) {
@@ -33,6 +33,10 @@ void SnesCpu::Exec()
 
 	if(_state.StopState == SnesCpuStopState::Running) {
 #ifndef DUMMYCPU
+		if(_idleLoopSkipEnabled) {
+			ProcessIdleLoop();
+		}
+
 		_emu->ProcessInstruction<CpuType::Snes>();
 #endif
 
@@ -65,6 +69,7 @@ void SnesCpu::ProcessHaltedState()
 {
 #ifndef DUMMYCPU
 	_emu->ProcessHaltedCpu<CpuType::Snes>();
+	_idleLoopSafe = false;
 #endif
 
 	if(_state.StopState == SnesCpuStopState::Stopped) {
@@ -146,6 +151,11 @@ uint8_t SnesCpu::Read(uint32_t addr, MemoryOperationType type)
 	_memoryManager->SetCpuSpeed(_memoryManager->GetCpuSpeed(addr));
 	ProcessCpuCycle();
 	uint8_t value = _memoryManager->Read(addr, type);
+	if(_idleLoopSafe) {
+		//Only reads from memory that nothing else can modify during the loop (without a CPU write, DMA or IRQ) are allowed
+		MemoryType memType = _memoryManager->GetMemoryTypeBusA();
+		_idleLoopSafe = memType == MemoryType::SnesWorkRam || memType == MemoryType::SnesPrgRom || memType == MemoryType::SnesSaveRam;
+	}
 	UpdateIrqNmiFlags();
 	return value;
 }
@@ -155,6 +165,64 @@ void SnesCpu::Write(uint32_t addr, uint8_t value, MemoryOperationType type)
 	_memoryManager->SetCpuSpeed(_memoryManager->GetCpuSpeed(addr));
 	ProcessCpuCycle();
 	_memoryManager->Write(addr, value, type);
+	_idleLoopSafe = false;
 	UpdateIrqNmiFlags();
 }
+
+void SnesCpu::SetIdleLoopSkip(bool enabled)
+{
+	//Called at the start of each frame, also discards any tracking done before a save state was loaded
+	_idleLoopSkipEnabled = enabled;
+	_idleLoopSafe = false;
+	_idleLoopAddr = 0;
+	_prevInstAddr = 0;
+}
+
+void SnesCpu::ProcessIdleLoop()
+{
+	uint32_t addr = (_state.K << 16) | _state.PC;
+
+	if(addr == _idleLoopAddr) {
+		//An iteration of the loop was completed
+		uint64_t masterClock = _memoryManager->GetMasterClock();
+		uint64_t loopClocks = masterClock - _idleLoopStartClock;
+		uint64_t loopCycles = _state.CycleCount - _idleLoopState.CycleCount;
+
+		if(_idleLoopSafe && loopClocks == _idleLoopClocks && IsIdleLoopStateMatch() && !_dmaController->HasPendingTransfers()) {
+			//The last 2 iterations started from the same CPU state, took the same amount of time, didn't write
+			//anything and only read from WRAM/ROM/SRAM. Every following iteration will be identical to them
+			//until the next scheduled event, IRQ or NMI, so skip as many of them as possible in a single step
+			uint32_t count = _memoryManager->SkipIdleLoop((uint32_t)loopClocks);
+			_state.CycleCount += count * loopCycles;
+			masterClock = _memoryManager->GetMasterClock();
+		}
+
+		_idleLoopStartClock = masterClock;
+		_idleLoopClocks = loopClocks;
+		_idleLoopState = _state;
+		_idleLoopSafe = true;
+	} else if(addr < _prevInstAddr && _prevInstAddr - addr <= SnesCpu::MaxIdleLoopSize && (addr >> 16) == (_prevInstAddr >> 16)) {
+		//Short backward jump/branch, start tracking a potential idle loop
+		_idleLoopAddr = addr;
+		_idleLoopStartClock = _memoryManager->GetMasterClock();
+		_idleLoopClocks = 0;
+		_idleLoopState = _state;
+		_idleLoopSafe = true;
+	}
+
+	_prevInstAddr = addr;
+}
+
+bool SnesCpu::IsIdleLoopStateMatch()
+{
+	SnesCpuState& prev = _idleLoopState;
+	return (
+		_state.A == prev.A && _state.X == prev.X && _state.Y == prev.Y && _state.SP == prev.SP &&
+		_state.D == prev.D && _state.PC == prev.PC && _state.K == prev.K && _state.DBR == prev.DBR &&
+		_state.PS == prev.PS && _state.EmulationMode == prev.EmulationMode &&
+		_state.NmiFlag == prev.NmiFlag && _state.PrevNmiFlag == prev.PrevNmiFlag &&
+		_state.IrqLock == prev.IrqLock && _state.NeedNmi == prev.NeedNmi && _state.PrevNeedNmi == prev.PrevNeedNmi &&
+		_state.IrqSource == prev.IrqSource && _state.PrevIrqSource == prev.PrevIrqSource
+	);
+}
 #endif
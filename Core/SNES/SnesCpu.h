@@ -43,6 +43,19 @@ private:
 	SnesCpuState _state = {};
 	uint32_t _operand = 0;
 
+	//Idle loop detection state (see ProcessIdleLoop)
+	static constexpr uint32_t MaxIdleLoopSize = 0x40;
+	bool _idleLoopSkipEnabled = false;
+	bool _idleLoopSafe = false;
+	uint32_t _idleLoopAddr = 0;
+	uint32_t _prevInstAddr = 0;
+	uint64_t _idleLoopStartClock = 0;
+	uint64_t _idleLoopClocks = 0;
+	SnesCpuState _idleLoopState = {};
+
+	void ProcessIdleLoop();
+	bool IsIdleLoopStateMatch();
+
 	uint32_t GetProgramAddress(uint16_t addr);
 	uint32_t GetDataAddress(uint16_t addr);
 
@@ -341,6 +354,8 @@ public:
 	void Reset();
 	void Exec();
 
+	void SetIdleLoopSkip(bool enabled);
+
 	SnesCpuState& GetState();
 	uint64_t GetCycleCount();
 
@@ -127,31 +127,22 @@ void SnesMemoryManager::GenerateMasterClockTable()
 
 void SnesMemoryManager::IncMasterClock4()
 {
-	Exec();
-	Exec();
+	IncrementMasterClock(4);
 }
 
 void SnesMemoryManager::IncMasterClock6()
 {
-	Exec();
-	Exec();
-	Exec();
+	IncrementMasterClock(6);
 }
 
 void SnesMemoryManager::IncMasterClock8()
 {
-	Exec();
-	Exec();
-	Exec();
-	Exec();
+	IncrementMasterClock(8);
 }
 
 void SnesMemoryManager::IncMasterClock40()
 {
-	Exec(); Exec(); Exec(); Exec(); Exec();
-	Exec(); Exec(); Exec(); Exec(); Exec();
-	Exec(); Exec(); Exec(); Exec(); Exec();
-	Exec(); Exec(); Exec(); Exec(); Exec();
+	IncrementMasterClock(40);
 }
 
 void SnesMemoryManager::IncMasterClockStartup()
@@ -159,18 +150,63 @@ void SnesMemoryManager::IncMasterClockStartup()
 	for(int i = 0; i < 182 / 2; i++) {
 		Exec();
 	}
+	_cart->SyncCoprocessors();
 }
 
 void SnesMemoryManager::IncrementMasterClockValue(uint16_t cyclesToRun)
 {
-	switch(cyclesToRun) {
-		case 12: Exec(); [[fallthrough]];
-		case 10: Exec(); [[fallthrough]];
-		case 8: Exec(); [[fallthrough]];
-		case 6: Exec(); [[fallthrough]];
-		case 4: Exec(); [[fallthrough]];
-		case 2: Exec(); break;
+	if(cyclesToRun <= 12) {
+		IncrementMasterClock(cyclesToRun);
+	}
+}
+
+uint32_t SnesMemoryManager::SkipIdleLoop(uint32_t loopClocks)
+{
+	//Returns the number of loop iterations that were skipped - only whole iterations that end
+	//before the next scheduled event and that can't trigger an IRQ are skipped
+	if(loopClocks == 0 || _nextEventClock <= _hClock || _emu->IsDebugging()) {
+		return 0;
+	}
+
+	uint32_t count = (_nextEventClock - _hClock - 1) / loopClocks;
+	if(count == 0) {
+		return 0;
+	}
+
+	uint16_t hClockEnd = _hClock + count * loopClocks;
+	if(!_regs->IsIrqCounterIdle(hClockEnd)) {
+		return 0;
+	}
+
+	_masterClock += count * loopClocks;
+	_hClock = hClockEnd;
+	_regs->ProcessIrqCounters();
+	return count;
+}
+
+void SnesMemoryManager::IncrementMasterClock(uint16_t clocks)
+{
+	uint16_t hClockEnd = _hClock + clocks;
+	if(hClockEnd < _nextEventClock && !_emu->IsDebugging() && _regs->IsIrqCounterIdle(hClockEnd)) {
+		//No scheduled event (DRAM refresh, HDMA, end of scanline) or IRQ can occur before hClockEnd, and no
+		//debugger needs per-dot callbacks: advance the clock in a single step instead of 2 master clocks at a time
+		bool processCounters = (hClockEnd >> 2) != (_hClock >> 2);
+		_masterClock += clocks;
+		_hClock = hClockEnd;
+
+		if(processCounters) {
+			//The IRQ counters are idle, this only updates the NMI line (which can't change during the skipped clocks)
+			_regs->ProcessIrqCounters();
+		}
+	} else {
+		for(uint16_t i = 0; i < clocks; i += 2) {
+			Exec();
+		}
 	}
+
+	//Coprocessors catch up to the current master clock. The CPU can only observe their state (memory, registers,
+	//IRQ signal) between calls to this function, so syncing once here is equivalent to syncing every 2 clocks
+	_cart->SyncCoprocessors();
 }
 
 void SnesMemoryManager::Exec()
@@ -186,8 +222,6 @@ void SnesMemoryManager::Exec()
 		_emu->ProcessPpuCycle<CpuType::Snes>();
 		_regs->ProcessIrqCounters();
 	}
-
-	_cart->SyncCoprocessors();
 }
 
 void SnesMemoryManager::ProcessEvent()
@@ -200,10 +234,7 @@ void SnesMemoryManager::ProcessEvent()
 			break;
 
 		case SnesEventType::DramRefresh:
-			IncMasterClock40();
-			//TODOv2?
-			//_cpu->IncreaseCycleCount<5>();
-
+			//Schedule the next event before running the refresh's 40 clocks, so they can be skipped in a single step
 			if(_ppu->GetScanline() < _ppu->GetVblankStart()) {
 				_nextEvent = SnesEventType::HdmaStart;
 				_nextEventClock = 276 * 4;
@@ -211,6 +242,10 @@ void SnesMemoryManager::ProcessEvent()
 				_nextEvent = SnesEventType::EndOfScanline;
 				_nextEventClock = 1360;
 			}
+
+			IncMasterClock40();
+			//TODOv2?
+			//_cpu->IncreaseCycleCount<5>();
 			break;
 
 		case SnesEventType::HdmaStart:
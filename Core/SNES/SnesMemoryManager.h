@@ -60,6 +60,7 @@ private:
 	uint8_t _masterClockTable[0x800] = {};
 
 	void Exec();
+	__forceinline void IncrementMasterClock(uint16_t clocks);
 
 	void ProcessEvent();
 
@@ -77,6 +78,7 @@ public:
 	void IncMasterClock40();
 	void IncMasterClockStartup();
 	void IncrementMasterClockValue(uint16_t value);
+	uint32_t SkipIdleLoop(uint32_t loopClocks);
 
 	uint8_t Read(uint32_t addr, MemoryOperationType type);
 	uint8_t ReadDma(uint32_t addr, bool forBusA);
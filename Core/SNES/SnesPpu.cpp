@@ -37,10 +37,24 @@ SnesPpu::SnesPpu(Emulator* emu, SnesConsole* console)
 	_outputBuffers[1] = new uint16_t[512 * 478];
 	memset(_outputBuffers[0], 0, 512 * 478 * sizeof(uint16_t));
 	memset(_outputBuffers[1], 0, 512 * 478 * sizeof(uint16_t));
+
+	_renderPending = false;
+	_stopRenderThread = false;
+}
+
+SnesPpu::SnesPpu(Emulator* emu)
+{
+	//Render-only instance used by the render thread - draws into the main instance's output buffer
+	_emu = emu;
+	_console = nullptr;
+	_renderPending = false;
+	_stopRenderThread = false;
 }
 
 SnesPpu::~SnesPpu()
 {
+	StopRenderThread();
+
 	delete[] _vram;
 	delete[] _outputBuffers[0];
 	delete[] _outputBuffers[1];
@@ -408,6 +422,7 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock)
 				UpdateNmiScanline();
 
 				if(!_skipRender) {
+					WaitForRenderThread();
 					_currentBuffer = _currentBuffer == _outputBuffers[0] ? _outputBuffers[1] : _outputBuffers[0];
 					if(_interlacedFrame) {
 						memcpy(_currentBuffer, GetPreviousScreenBuffer(), 512 * 478 * sizeof(uint16_t));
@@ -475,6 +490,12 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock)
 			SnesConfig& cfg = _settings->GetSnesConfig();
 			_configVisibleLayers = (cfg.HideBgLayer1 ? 0 : 1) | (cfg.HideBgLayer2 ? 0 : 2) | (cfg.HideBgLayer3 ? 0 : 4) | (cfg.HideBgLayer4 ? 0 : 8) | (cfg.HideSprites ? 0 : 16);
 
+			if(cfg.EnableParallelPpuRendering) {
+				StartRenderThread();
+			} else {
+				StopRenderThread();
+			}
+
 			_emu->ProcessEvent(EventType::EndFrame);
 
 			_frameCount++;
@@ -878,28 +899,15 @@ void SnesPpu::RenderScanline()
 	if(!_skipRender && _drawStartX <= 255 && hPos > 22 && _scanline > 0) {
 		_drawEndX = std::min(hPos - 22, 255);
 
-		if(_state.ForcedBlank) {
-			//Forced blank, output black
-			memset(_mainScreenBuffer + _drawStartX, 0, (_drawEndX - _drawStartX + 1) * 2);
-			memset(_subScreenBuffer + _drawStartX, 0, (_drawEndX - _drawStartX + 1) * 2);
+		if(_renderThread && _drawStartX == 0 && _drawEndX == 255 && _state.BgMode != 7 && !_emu->IsDebugging()) {
+			//The whole line can be drawn at once, let the render thread draw it
+			//Mode 7 is always drawn here because it updates the scroll latches and debug overlay values
+			DrawScanlineAsync();
 		} else {
-			switch(_state.BgMode) {
-				case 0: RenderMode0(); break;
-				case 1: RenderMode1(); break;
-				case 2: RenderMode2(); break;
-				case 3: RenderMode3(); break;
-				case 4: RenderMode4(); break;
-				case 5: RenderMode5(); break;
-				case 6: RenderMode6(); break;
-				case 7: RenderMode7(); break;
-			}
-			RenderBgColor();
+			WaitForRenderThread();
+			DrawScanline();
 		}
 
-		ApplyColorMath();
-		ApplyBrightness<true>();
-		ApplyHiResMode();
-
 		_drawStartX = _drawEndX + 1;
 	}
 	
@@ -914,6 +922,117 @@ void SnesPpu::RenderScanline()
 	}
 }
 
+void SnesPpu::DrawScanline()
+{
+	if(_state.ForcedBlank) {
+		//Forced blank, output black
+		memset(_mainScreenBuffer + _drawStartX, 0, (_drawEndX - _drawStartX + 1) * 2);
+		memset(_subScreenBuffer + _drawStartX, 0, (_drawEndX - _drawStartX + 1) * 2);
+	} else {
+		switch(_state.BgMode) {
+			case 0: RenderMode0(); break;
+			case 1: RenderMode1(); break;
+			case 2: RenderMode2(); break;
+			case 3: RenderMode3(); break;
+			case 4: RenderMode4(); break;
+			case 5: RenderMode5(); break;
+			case 6: RenderMode6(); break;
+			case 7: RenderMode7(); break;
+		}
+		RenderBgColor();
+	}
+
+	ApplyColorMath();
+	ApplyBrightness<true>();
+	ApplyHiResMode();
+}
+
+void SnesPpu::DrawScanlineAsync()
+{
+	WaitForRenderThread();
+
+	//Copy everything the drawing code reads - the main instance can then keep updating its own state while the line is drawn
+	SnesPpu* ppu = _renderPpu.get();
+	ppu->_state = _state;
+	memcpy(ppu->_layerData, _layerData, sizeof(_layerData));
+	memcpy(ppu->_cgram, _cgram, sizeof(_cgram));
+	memcpy(ppu->_spritePriority, _spritePriority, sizeof(_spritePriority));
+	memcpy(ppu->_spritePalette, _spritePalette, sizeof(_spritePalette));
+	memcpy(ppu->_spriteColors, _spriteColors, sizeof(_spriteColors));
+	memset(ppu->_mainScreenFlags, 0, sizeof(_mainScreenFlags));
+	memset(ppu->_subScreenPriority, 0, sizeof(_subScreenPriority));
+
+	ppu->_configVisibleLayers = _configVisibleLayers;
+	ppu->_mosaicScanlineCounter = _mosaicScanlineCounter;
+	ppu->_scanline = _scanline;
+	ppu->_oddFrame = _oddFrame;
+	ppu->_overscanFrame = _overscanFrame;
+	ppu->_useHighResOutput = _useHighResOutput;
+	ppu->_currentBuffer = _currentBuffer;
+	ppu->_drawStartX = _drawStartX;
+	ppu->_drawEndX = _drawEndX;
+
+	_renderPending = true;
+	_renderSignal.Signal();
+
+#ifdef _DEBUG
+	//Draw the same line on this thread, like when the option is disabled, and make sure the render thread's output is identical
+	WaitForRenderThread();
+	DrawScanline();
+	uint32_t length = (_drawEndX - _drawStartX + 1) * sizeof(uint16_t);
+	assert(memcmp(_mainScreenBuffer + _drawStartX, ppu->_mainScreenBuffer + _drawStartX, length) == 0);
+	assert(memcmp(_subScreenBuffer + _drawStartX, ppu->_subScreenBuffer + _drawStartX, length) == 0);
+#endif
+
+	//Done by ApplyHiResMode when drawing on this thread
+	if(_useHighResOutput) {
+		_interlacedFrame |= _state.ScreenInterlace;
+	}
+}
+
+void SnesPpu::RenderThread()
+{
+	while(!_stopRenderThread) {
+		_renderSignal.Wait();
+		if(_renderPending) {
+			_renderPpu->DrawScanline();
+			_renderPending = false;
+			_renderDone.Signal();
+		}
+	}
+}
+
+void SnesPpu::StartRenderThread()
+{
+	if(!_renderThread) {
+		_renderPpu.reset(new SnesPpu(_emu));
+		_stopRenderThread = false;
+		_renderSignal.Reset();
+		_renderDone.Reset();
+		_renderThread.reset(new thread(&SnesPpu::RenderThread, this));
+	}
+}
+
+void SnesPpu::StopRenderThread()
+{
+	if(_renderThread) {
+		WaitForRenderThread();
+		_stopRenderThread = true;
+		_renderSignal.Signal();
+		_renderThread->join();
+		_renderThread.reset();
+		_renderPpu.reset();
+	}
+}
+
+void SnesPpu::WaitForRenderThread()
+{
+	//The done signal can be left over from a line that had already finished when it was last checked, so check the flag again after waking up
+	while(_renderPending) {
+		_renderDone.Wait();
+	}
+}
+
 void SnesPpu::RenderBgColor()
 {
 	uint8_t pixelFlags = (_state.ColorMathEnabled & 0x20) ? PixelFlags::AllowColorMath : 0;
@@ -1180,6 +1299,13 @@ void SnesPpu::RenderTilemapMode7()
 	
 	uint8_t pixelFlags = ((_state.ColorMathEnabled >> layerIndex) & 0x01) ? PixelFlags::AllowColorMath : 0;
 
+	//Sample the whole segment first, then draw it - this keeps the coordinate calculations
+	//and VRAM fetches in a tight loop, separate from the mosaic/priority/window logic below
+	constexpr uint16_t outsideMap = 0x100;
+	uint16_t samples[256];
+	bool largeMap = _state.Mode7.LargeMap;
+	bool fillWithTile0 = _state.Mode7.FillWithTile0;
+
 	for(int x = _drawStartX; x <= _drawEndX; x++) {
 		int32_t xOffset = xValue >> 8;
 		int32_t yOffset = yValue >> 8;
@@ -1187,16 +1313,17 @@ void SnesPpu::RenderTilemapMode7()
 		yValue += yStep;
 
 		uint8_t tileIndex;
-		if(!_state.Mode7.LargeMap) {
+		if(!largeMap) {
 			yOffset &= 0x3FF;
 			xOffset &= 0x3FF;
 			tileIndex = (uint8_t)_vram[((yOffset & ~0x07) << 4) | (xOffset >> 3)];
 		} else {
 			if(yOffset < 0 || yOffset > 0x3FF || xOffset < 0 || xOffset > 0x3FF) {
-				if(_state.Mode7.FillWithTile0) {
+				if(fillWithTile0) {
 					tileIndex = 0;
 				} else {
 					//Draw nothing for this pixel, we're outside the map
+					samples[x] = outsideMap;
 					continue;
 				}
 			} else {
@@ -1204,15 +1331,23 @@ void SnesPpu::RenderTilemapMode7()
 			}
 		}
 
+		samples[x] = _vram[((tileIndex << 6) + ((yOffset & 0x07) << 3) + (xOffset & 0x07))] >> 8;
+	}
+
+	for(int x = _drawStartX; x <= _drawEndX; x++) {
+		if(samples[x] == outsideMap) {
+			continue;
+		}
+
 		uint16_t colorIndex;
 		uint8_t priority;
 		if constexpr(layerIndex == 1) {
-			uint8_t color = _vram[((tileIndex << 6) + ((yOffset & 0x07) << 3) + (xOffset & 0x07))] >> 8;
+			uint8_t color = (uint8_t)samples[x];
 			priority = (color & 0x80) ? highPriority : normalPriority;
 			colorIndex = (color & 0x7F);
 		} else {
 			priority = normalPriority;
-			colorIndex = _vram[((tileIndex << 6) + ((yOffset & 0x07) << 3) + (xOffset & 0x07))] >> 8;
+			colorIndex = samples[x];
 		}
 
 		if(applyMosaic) {
@@ -1354,32 +1489,49 @@ void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bo
 		otherPixel = _state.FixedColor;
 	}
 
-	constexpr unsigned int mask = 0x1F;
 	if(_state.ColorMathSubtractMode) {
-		uint16_t r = std::max((int)((pixelA & mask) - (otherPixel & mask)), 0) >> halfShift;
-		uint16_t g = std::max((int)(((pixelA >> 5U) & mask) - ((otherPixel >> 5U) & mask)), 0) >> halfShift;
-		uint16_t b = std::max((int)(((pixelA >> 10U) & mask) - ((otherPixel >> 10U) & mask)), 0) >> halfShift;
-
-		pixelA = r | (g << 5U) | (b << 10U);
+		pixelA = SubtractColors(pixelA & 0x7FFF, otherPixel & 0x7FFF, halfShift);
 	} else {
-		uint16_t r = std::min(((pixelA & mask) + (otherPixel & mask)) >> halfShift, mask);
-		uint16_t g = std::min((((pixelA >> 5U) & mask) + ((otherPixel >> 5U) & mask)) >> halfShift, mask);
-		uint16_t b = std::min((((pixelA >> 10U) & mask) + ((otherPixel >> 10U) & mask)) >> halfShift, mask);
+		pixelA = AddColors(pixelA & 0x7FFF, otherPixel & 0x7FFF, halfShift);
+	}
+}
 
-		pixelA = r | (g << 5U) | (b << 10U);
+uint16_t SnesPpu::AddColors(uint32_t a, uint32_t b, bool halve)
+{
+	//Adds all 3 channels at once - the carry out of each 5-bit channel is detected
+	//and used to saturate that channel to 31 (or to average both colors when halving)
+	if(halve) {
+		return (a + b - ((a ^ b) & 0x0421)) >> 1;
+	} else {
+		uint32_t sum = a + b;
+		uint32_t carry = (sum - ((a ^ b) & 0x0421)) & 0x8420;
+		return (sum - carry) | (carry - (carry >> 5));
 	}
 }
 
+uint16_t SnesPpu::SubtractColors(uint32_t a, uint32_t b, bool halve)
+{
+	//Subtracts all 3 channels at once - channels that borrowed are clamped to 0
+	uint32_t diff = a - b + 0x8420;
+	uint32_t borrow = (diff - ((a ^ b) & 0x8420)) & 0x8420;
+	uint32_t result = (diff - borrow) & (borrow - (borrow >> 5));
+	return halve ? ((result & 0x7BDE) >> 1) : result;
+}
+
 template<bool forMainScreen>
 void SnesPpu::ApplyBrightness()
 {
 	if(_state.ScreenBrightness != 15) {
+		//Scale each channel through a lookup table, built once per call instead of dividing every channel
+		uint8_t channelLut[32];
+		for(int i = 0; i < 32; i++) {
+			channelLut[i] = i * _state.ScreenBrightness / 15;
+		}
+
+		uint16_t* buffer = forMainScreen ? _mainScreenBuffer : _subScreenBuffer;
 		for(int x = _drawStartX; x <= _drawEndX; x++) {
-			uint16_t &pixel = (forMainScreen ? _mainScreenBuffer : _subScreenBuffer)[x];
-			uint16_t r = (pixel & 0x1F) * _state.ScreenBrightness / 15;
-			uint16_t g = ((pixel >> 5) & 0x1F) * _state.ScreenBrightness / 15;
-			uint16_t b = ((pixel >> 10) & 0x1F) * _state.ScreenBrightness / 15;
-			pixel = r | (g << 5) | (b << 10);
+			uint16_t pixel = buffer[x];
+			buffer[x] = channelLut[pixel & 0x1F] | (channelLut[(pixel >> 5) & 0x1F] << 5) | (channelLut[(pixel >> 10) & 0x1F] << 10);
 		}
 	}
 }
@@ -1395,6 +1547,8 @@ void SnesPpu::ConvertToHiRes()
 		return;
 	}
 
+	WaitForRenderThread();
+
 	//Convert standard res picture to high resolution when the PPU starts drawing in high res mid frame
 	_useHighResOutput = useHighResOutput;
 
@@ -1490,6 +1644,8 @@ void SnesPpu::ProcessWindowMaskSettings(uint8_t value, uint8_t offset)
 
 void SnesPpu::SendFrame()
 {
+	WaitForRenderThread();
+
 	uint16_t width = _useHighResOutput ? 512 : 256;
 	uint16_t height = _useHighResOutput ? 478 : 239;
 
@@ -1522,6 +1678,7 @@ void SnesPpu::DebugSendFrame()
 	if(_scanline < _vblankStartScanline) {
 		RenderScanline();
 	}
+	WaitForRenderThread();
 
 	uint16_t width = _useHighResOutput ? 512 : 256;
 	uint16_t height = _useHighResOutput ? 478 : 239;
@@ -2218,6 +2375,8 @@ void SnesPpu::Write(uint32_t addr, uint8_t value)
 
 void SnesPpu::Serialize(Serializer &s)
 {
+	WaitForRenderThread();
+
 	SV(_state.ForcedBlank); SV(_state.ScreenBrightness); SV(_scanline); SV(_frameCount);  SV(_state.BgMode);
 	SV(_state.Mode1Bg3Priority); SV(_state.MainScreenLayers); SV(_state.SubScreenLayers); SV(_state.VramAddress); SV(_state.VramIncrementValue); SV(_state.VramAddressRemapping);
 	SV(_state.VramAddrIncrementOnSecondReg); SV(_state.VramReadBuffer); SV(_state.Ppu1OpenBus); SV(_state.Ppu2OpenBus); SV(_state.CgramAddress); SV(_state.MosaicSize); SV(_state.MosaicEnabled);
@@ -3,6 +3,7 @@
 #include "SNES/SnesPpuTypes.h"
 #include "Utilities/ISerializable.h"
 #include "Utilities/Timer.h"
+#include "Utilities/AutoResetEvent.h"
 
 class Emulator;
 class SnesConsole;
@@ -122,6 +123,25 @@ private:
 
 	bool _needFullFrame = false;
 
+	//Optional worker thread that draws complete scanlines while the main thread keeps emulating.
+	//The worker uses a render-only PPU instance that receives a copy of the state needed to draw the line.
+	unique_ptr<SnesPpu> _renderPpu;
+	unique_ptr<thread> _renderThread;
+	AutoResetEvent _renderSignal;
+	AutoResetEvent _renderDone;
+	atomic<bool> _renderPending;
+	atomic<bool> _stopRenderThread;
+
+	SnesPpu(Emulator* emu);
+
+	void DrawScanline();
+	void DrawScanlineAsync();
+
+	void RenderThread();
+	void StartRenderThread();
+	void StopRenderThread();
+	__forceinline void WaitForRenderThread();
+
 	void RenderSprites(const uint8_t priorities[4]);
 
 	template<bool hiResMode>
@@ -179,6 +199,8 @@ private:
 
 	void ApplyColorMath();
 	void ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool isInsideWindow);
+	__forceinline static uint16_t AddColors(uint32_t a, uint32_t b, bool halve);
+	__forceinline static uint16_t SubtractColors(uint32_t a, uint32_t b, bool halve);
 	
 	template<bool forMainScreen>
 	void ApplyBrightness();
@@ -0,0 +1,238 @@
+#include "pch.h"
+#include "Shared/Audio/AudioStream.h"
+
+SimpleLock AudioStream::_threadLock;
+SimpleLock AudioStream::_streamLock;
+vector<AudioStream*> AudioStream::_streams;
+unique_ptr<thread> AudioStream::_decodeThread;
+AutoResetEvent AudioStream::_decodeSignal;
+atomic<bool> AudioStream::_stopFlag;
+
+AudioStream::AudioStream(uint32_t positionStep)
+{
+	_positionStep = positionStep;
+	_readPos = 0;
+	_writePos = 0;
+	_playPosition = 0;
+	_endOfStream = true;
+	_loop = false;
+
+	//The decode thread ignores the stream until StartStream is called, so it can be registered before the subclass is constructed
+	auto threadLock = _threadLock.AcquireSafe();
+	{
+		auto lock = _streamLock.AcquireSafe();
+		_streams.push_back(this);
+	}
+
+	if(!_decodeThread) {
+		_stopFlag = false;
+		_decodeThread.reset(new thread(&AudioStream::DecodeThread));
+	}
+}
+
+void AudioStream::StartStream(bool loop, uint32_t startPosition)
+{
+	_readPos = 0;
+	_writePos = 0;
+	_bufferStart = 0;
+	_playPosition = startPosition;
+	_endOfStream = false;
+	_loop = loop;
+	_started = true;
+	_decodeSignal.Signal();
+}
+
+void AudioStream::ClearStream()
+{
+	_readPos = 0;
+	_writePos = 0;
+	_bufferStart = 0;
+	_endOfStream = true;
+	_started = false;
+}
+
+bool AudioStream::SeekBuffered(bool loop, uint32_t position)
+{
+	if(loop != _loop) {
+		//Frames decoded past the end of the track depend on the loop flag
+		return false;
+	}
+
+	auto lock = _decodeLock.AcquireSafe();
+
+	//The buffer contains the last BufferSize frames that were decoded - the decode thread keeps
+	//the last HistorySize played frames, so this usually includes the position of recent save states
+	uint32_t writePos = _writePos;
+	uint32_t start = writePos - std::min(writePos - _bufferStart, BufferSize);
+	for(uint32_t i = start; i != writePos; i++) {
+		if(_positions[i & BufferMask] == position) {
+			_playPosition = position;
+			_readPos = i;
+			_decodeSignal.Signal();
+			return true;
+		}
+	}
+	return false;
+}
+
+void AudioStream::StopStream()
+{
+	auto threadLock = _threadLock.AcquireSafe();
+
+	bool lastStream;
+	{
+		//The decode thread holds this lock while decoding, so the stream is no longer in use once it's removed
+		auto lock = _streamLock.AcquireSafe();
+		_streams.erase(std::remove(_streams.begin(), _streams.end(), this), _streams.end());
+		lastStream = _streams.empty();
+	}
+
+	if(lastStream && _decodeThread) {
+		_stopFlag = true;
+		_decodeSignal.Signal();
+		_decodeThread->join();
+		_decodeThread.reset();
+	}
+	_endOfStream = true;
+}
+
+void AudioStream::DecodeChunk()
+{
+	int16_t chunk[ChunkSize * 2];
+	uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+	uint32_t frameCount = 0;
+	bool looped = false;
+	bool endOfStream = false;
+	while(frameCount < ChunkSize) {
+		uint32_t position = GetDecodePosition();
+		uint32_t count = Decode(chunk + frameCount * 2, ChunkSize - frameCount);
+		for(uint32_t i = 0; i < count; i++) {
+			_positions[(writePos + frameCount + i) & BufferMask] = position + i * _positionStep;
+		}
+		frameCount += count;
+
+		if(frameCount < ChunkSize) {
+			//Seek back to the loop point ahead of time, so looping doesn't interrupt playback
+			//Stop if nothing could be decoded after seeking, to avoid looping forever on an empty loop
+			if(!_loop || (looped && count == 0) || !SeekToLoopPoint()) {
+				endOfStream = true;
+				break;
+			}
+			looped = true;
+		}
+	}
+
+	for(uint32_t i = 0; i < frameCount; i++) {
+		uint32_t index = (writePos + i) & BufferMask;
+		_samples[index * 2] = chunk[i * 2];
+		_samples[index * 2 + 1] = chunk[i * 2 + 1];
+	}
+	_writePos.store(writePos + frameCount, std::memory_order_release);
+
+	//Only flag the end of the stream once the last frames are visible to the reader
+	if(endOfStream) {
+		_endOfStream = true;
+	}
+}
+
+bool AudioStream::DecodeAhead()
+{
+	auto lock = _decodeLock.AcquireSafe();
+	uint32_t bufferedFrames = _writePos.load(std::memory_order_relaxed) - _readPos.load(std::memory_order_acquire);
+	if(_endOfStream || bufferedFrames + ChunkSize + HistorySize > BufferSize) {
+		return false;
+	}
+
+	DecodeChunk();
+	return true;
+}
+
+void AudioStream::DecodeThread()
+{
+	while(!_stopFlag.load()) {
+		bool decoded = false;
+		{
+			auto lock = _streamLock.AcquireSafe();
+			for(AudioStream* stream : _streams) {
+				decoded |= stream->DecodeAhead();
+			}
+		}
+
+		if(!decoded) {
+			//Wait for the mixer to read samples from a buffer, or for a new stream to be started
+			_decodeSignal.Wait();
+		}
+	}
+}
+
+uint32_t AudioStream::ReadFrames(int16_t* out, uint32_t frameCount)
+{
+	frameCount = std::min(frameCount, BufferSize - ChunkSize);
+
+	//The end of stream flag is set after the last frames are written, so it must be read before the write position
+	bool endOfStream = _endOfStream;
+	uint32_t readPos = _readPos.load(std::memory_order_relaxed);
+	uint32_t writePos = _writePos.load(std::memory_order_acquire);
+	if(writePos - readPos < frameCount && !endOfStream) {
+		//The decode thread is behind, decode the missing frames now so playback doesn't depend on its timing
+		auto lock = _decodeLock.AcquireSafe();
+		while(_writePos - readPos < frameCount && !_endOfStream) {
+			DecodeChunk();
+		}
+		writePos = _writePos;
+	}
+
+	uint32_t count = std::min(writePos - readPos, frameCount);
+	if(count == 0) {
+		return 0;
+	}
+
+	for(uint32_t i = 0; i < count; i++) {
+		uint32_t index = (readPos + i) & BufferMask;
+		out[i * 2] = _samples[index * 2];
+		out[i * 2 + 1] = _samples[index * 2 + 1];
+	}
+	_playPosition = _positions[(readPos + count - 1) & BufferMask] + _positionStep;
+
+	_readPos.store(readPos + count, std::memory_order_release);
+	_decodeSignal.Signal();
+	return count;
+}
+
+bool AudioStream::IsEndOfStream()
+{
+	if(!_endOfStream && _readPos == _writePos) {
+		//Check if there is anything left to decode, instead of waiting for the decode thread to find out
+		auto lock = _decodeLock.AcquireSafe();
+		if(!_endOfStream && _readPos == _writePos) {
+			DecodeChunk();
+		}
+	}
+	return _endOfStream && _readPos.load(std::memory_order_relaxed) == _writePos.load(std::memory_order_acquire);
+}
+
+void AudioStream::SetLoopFlag(bool loop)
+{
+	if(_loop == loop) {
+		return;
+	}
+
+	auto lock = _decodeLock.AcquireSafe();
+	_loop = loop;
+
+	if(_started) {
+		//Frames decoded past the end of the track depend on the loop flag - discard everything
+		//after the current position and decode it again, the played frames are no longer valid seek targets
+		uint32_t readPos = _readPos;
+		_writePos = readPos;
+		_bufferStart = readPos;
+		_endOfStream = false;
+		Seek(_playPosition);
+		_decodeSignal.Signal();
+	}
+}
+
+uint32_t AudioStream::GetOffset()
+{
+	return _playPosition;
+}
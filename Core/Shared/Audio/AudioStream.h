@@ -0,0 +1,77 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+
+//Base class for streamed audio tracks (HD pack OGG files, MSU-1 PCM files)
+//Samples are decoded ahead of playback by a background thread (shared by all streams) into a ring buffer.
+//The buffer is only a cache: when it doesn't contain enough samples, the emulation thread decodes them itself,
+//so the samples returned, the end of stream flag and the playback position never depend on thread timing.
+class AudioStream
+{
+private:
+	static constexpr uint32_t BufferSize = 0x4000; //stereo frames, must be a power of 2
+	static constexpr uint32_t BufferMask = BufferSize - 1;
+	static constexpr uint32_t ChunkSize = 0x200;
+	//Frames kept in the buffer after being played, to allow seeking back to them when a recent state is loaded (e.g with run-ahead)
+	static constexpr uint32_t HistorySize = 0x2000;
+
+	static SimpleLock _threadLock;
+	static SimpleLock _streamLock;
+	static vector<AudioStream*> _streams;
+	static unique_ptr<thread> _decodeThread;
+	static AutoResetEvent _decodeSignal;
+	static atomic<bool> _stopFlag;
+
+	int16_t _samples[BufferSize * 2] = {};
+	//Stream position of each frame in the buffer, used to save/restore the playback position
+	uint32_t _positions[BufferSize] = {};
+
+	atomic<uint32_t> _readPos;
+	atomic<uint32_t> _writePos;
+	atomic<uint32_t> _playPosition;
+	atomic<bool> _endOfStream;
+	atomic<bool> _loop;
+	//First frame that can be used by SeekBuffered (frames before it were decoded with a different loop flag)
+	uint32_t _bufferStart = 0;
+	bool _started = false;
+
+	uint32_t _positionStep = 1;
+
+	void DecodeChunk();
+	bool DecodeAhead();
+	static void DecodeThread();
+
+protected:
+	//Held while decoding - must be held while changing the decoder's state (file, position)
+	SimpleLock _decodeLock;
+
+	//Called with _decodeLock held - returns the number of frames written, less than requested at the end of the stream
+	virtual uint32_t Decode(int16_t* out, uint32_t frameCount) = 0;
+	//Called with _decodeLock held when the end of the stream is reached while looping
+	virtual bool SeekToLoopPoint() = 0;
+	//Called with _decodeLock held to decode the stream again from a position that was already returned by GetDecodePosition()
+	virtual void Seek(uint32_t position) = 0;
+	//Position of the next frame returned by Decode()
+	virtual uint32_t GetDecodePosition() = 0;
+
+	//Discards the decoded samples and restarts decoding at the given position - _decodeLock must be held
+	void StartStream(bool loop, uint32_t startPosition);
+	//Discards the decoded samples and stops decoding until the next StartStream call - _decodeLock must be held
+	void ClearStream();
+	//Moves to a position that is still in the buffer (recently played or decoded ahead), returns false if it isn't
+	bool SeekBuffered(bool loop, uint32_t position);
+	//Removes the stream from the decode thread, must be called by the subclass' destructor (without holding _decodeLock)
+	void StopStream();
+
+	//Only returns less than frameCount frames at the end of the stream
+	uint32_t ReadFrames(int16_t* out, uint32_t frameCount);
+	bool IsEndOfStream();
+
+public:
+	AudioStream(uint32_t positionStep);
+	virtual ~AudioStream() = default;
+
+	void SetLoopFlag(bool loop);
+	uint32_t GetOffset();
+};
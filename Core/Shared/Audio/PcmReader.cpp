@@ -3,7 +3,8 @@
 #include "Utilities/VirtualFile.h"
 #include "Utilities/Audio/HermiteResampler.h"
 
-PcmReader::PcmReader()
+//Positions are byte offsets in the file (4 bytes per stereo frame)
+PcmReader::PcmReader() : AudioStream(4)
 {
 	_done = true;
 	_loopOffset = 8;
@@ -12,20 +13,35 @@ PcmReader::PcmReader()
 
 PcmReader::~PcmReader()
 {
+	StopStream();
 	delete[] _outputBuffer;
 }
 
 bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 {
+	_pcmBuffer.clear();
+	_resampler.Reset();
+
+	//Loading a state reloads the current track at the position that is being played (e.g every frame with run-ahead)
+	//Keep the samples that have already been decoded in this case, instead of reopening the file
+	if(!_done && filename == _filename && SeekBuffered(loop, startOffset)) {
+		return true;
+	}
+
+	auto lock = _decodeLock.AcquireSafe();
+
 	if(_file) {
 		_file.close();
 	}
 
+	_filename = filename;
 	_file.open(filename, ios::binary);
 	if(_file) {
 		_file.seekg(0, ios::end);
 		_fileSize = (uint32_t)_file.tellg();
 		if(_fileSize < 12) {
+			ClearStream();
+			_done = true;
 			return false;
 		}
 
@@ -37,19 +53,14 @@ bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 
 		_loopOffset = (uint32_t)loopOffset;
 
-		_prevLeft = 0;
-		_prevRight = 0;
 		_done = false;
-		_loop = loop;
 		_fileOffset = startOffset;
 		_file.seekg(_fileOffset, ios::beg);
 
-		_leftoverSampleCount = 0;
-		_pcmBuffer.clear();
-		_resampler.Reset();
-
+		StartStream(loop, _fileOffset);
 		return true;
 	} else {
+		ClearStream();
 		_done = true;
 		return false;
 	}
@@ -69,51 +80,42 @@ void PcmReader::SetSampleRate(uint32_t sampleRate)
 	}
 }
 
-void PcmReader::SetLoopFlag(bool loop)
+uint32_t PcmReader::Decode(int16_t* out, uint32_t frameCount)
 {
-	_loop = loop;
+	uint32_t framesLeft = _fileOffset < _fileSize ? (_fileSize - _fileOffset) / 4 : 0;
+	frameCount = std::min(frameCount, framesLeft);
+
+	_readBuffer.resize(frameCount * 4);
+	_file.read((char*)_readBuffer.data(), frameCount * 4);
+	frameCount = (uint32_t)_file.gcount() / 4;
+
+	for(uint32_t i = 0; i < frameCount; i++) {
+		uint8_t* val = _readBuffer.data() + i * 4;
+		out[i * 2] = val[0] | (val[1] << 8);
+		out[i * 2 + 1] = val[2] | (val[3] << 8);
+	}
+
+	_fileOffset += frameCount * 4;
+	return frameCount;
 }
 
-void PcmReader::ReadSample(int16_t &left, int16_t &right)
+bool PcmReader::SeekToLoopPoint()
 {
-	uint8_t val[4];
-	_file.get(((char*)val)[0]);
-	_file.get(((char*)val)[1]);
-	_file.get(((char*)val)[2]);
-	_file.get(((char*)val)[3]);
-
-	left = val[0] | (val[1] << 8);
-	right = val[2] | (val[3] << 8);
+	_fileOffset = _loopOffset * 4 + 8;
+	if(_fileOffset >= _fileSize) {
+		return false;
+	}
+
+	_file.clear();
+	_file.seekg(_fileOffset, ios::beg);
+	return true;
 }
 
-void PcmReader::LoadSamples(uint32_t samplesToLoad)
+void PcmReader::Seek(uint32_t position)
 {
-	uint32_t samplesRead = 0;
-
-	int16_t left = 0;
-	int16_t right = 0;
-	for(uint32_t i = _fileOffset; i < _fileSize && samplesRead < samplesToLoad; i+=4) {
-		ReadSample(left, right);
-
-		_pcmBuffer.push_back(left);
-		_pcmBuffer.push_back(right);
-
-		_prevLeft = left;
-		_prevRight = right;
-
-		_fileOffset += 4;
-		samplesRead++;
-
-		if(samplesRead < samplesToLoad && i + 4 >= _fileSize) {
-			if(_loop) {
-				i = _loopOffset * 4 + 8;
-				_fileOffset = i;
-				_file.seekg(_fileOffset, ios::beg);
-			} else {
-				_done = true;
-			}
-		}
-	}
+	_fileOffset = position;
+	_file.clear();
+	_file.seekg(_fileOffset, ios::beg);
 }
 
 void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume)
@@ -125,9 +127,12 @@ void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume
 	int32_t samplesNeeded = (int32_t)sampleCount - _resampler.GetPendingCount();
 	if(samplesNeeded > 0) {
 		uint32_t samplesToLoad = samplesNeeded * PcmReader::PcmSampleRate / _sampleRate + 2;
-		LoadSamples(samplesToLoad);
+		_pcmBuffer.resize(samplesToLoad * 2);
+		_pcmBuffer.resize(ReadFrames(_pcmBuffer.data(), samplesToLoad) * 2);
 	}
 
+	_done = IsEndOfStream();
+
 	uint32_t samplesRead = _resampler.Resample<false>(_pcmBuffer.data(), (uint32_t)_pcmBuffer.size() / 2, _outputBuffer, sampleCount);
 	_pcmBuffer.clear();
 
@@ -136,8 +141,3 @@ void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume
 		buffer[i] += (int16_t)((int32_t)_outputBuffer[i] * volume / 255);
 	}
 }
-
-uint32_t PcmReader::GetOffset()
-{
-	return _fileOffset;
-}
\ No newline at end of file
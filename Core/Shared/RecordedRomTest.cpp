@@ -145,7 +145,7 @@ void RecordedRomTest::Record(string filename, bool reset)
 	}
 }
 
-RomTestResult RecordedRomTest::Run(string filename)
+RomTestResult RecordedRomTest::Run(string filename, bool withDebugger)
 {
 	RomTestResult result = {};
 	_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
@@ -219,6 +219,11 @@ RomTestResult RecordedRomTest::Run(string filename)
 		_emu->Lock();
 		//Start playing movie
 		if(_emu->LoadRom(testRom, VirtualFile(""))) {
+			if(withDebugger) {
+				//Some cores take shortcuts when no debugger is attached (e.g the SNES skips over master clock
+				//steps when no event is pending) - running with the debugger checks they produce the same output
+				_emu->InitDebugger();
+			}
 			_emu->GetMovieManager()->Play(testMovie, true);
 			settings->SetFlag(EmulationFlags::MaximumSpeed);
 
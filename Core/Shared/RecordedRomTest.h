@@ -54,6 +54,6 @@ public:
 
 	void ProcessNotification(ConsoleNotificationType type, void* parameter) override;
 	void Record(string filename, bool reset);
-	RomTestResult Run(string filename);
+	RomTestResult Run(string filename, bool withDebugger = false);
 	void Stop();
 };
\ No newline at end of file
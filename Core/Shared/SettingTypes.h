@@ -531,6 +531,8 @@ struct SnesConfig
 
 	bool EnableRandomPowerOnState = false;
 	bool EnableStrictBoardMappings = false;
+	bool EnableIdleLoopSkip = false;
+	bool EnableParallelPpuRendering = false;
 	RamState RamPowerOnState = RamState::Random;
 	int32_t SpcClockSpeedAdjustment = 0;
 
@@ -888,9 +888,11 @@ static INLINE void calc_envelope(OPLL_SLOT *slot, OPLL_SLOT *buddy, uint16_t eg_
 
 static void update_slots(OPLL *opll) {
   int i;
+  /* VRC7 (chip_type 1) only outputs channels 1-6, the slots for channels 7-9 are never heard */
+  const int slot_count = opll->chip_type == 1 ? 12 : 18;
   opll->eg_counter++;
 
-  for (i = 0; i < 18; i++) {
+  for (i = 0; i < slot_count; i++) {
     OPLL_SLOT *slot = &opll->slot[i];
     OPLL_SLOT *buddy = NULL;
     if (slot->type == 0) {
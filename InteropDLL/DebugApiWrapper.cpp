@@ -16,6 +16,7 @@
 #include "Core/Debugger/LabelManager.h"
 #include "Core/Debugger/ScriptManager.h"
 #include "Core/Debugger/Profiler.h"
+#include "Core/Debugger/SamplingProfiler.h"
 #include "Core/Debugger/IAssembler.h"
 #include "Core/Debugger/BaseEventManager.h"
 #include "Core/Debugger/ITraceLogger.h"
@@ -98,6 +99,8 @@ extern "C"
 		WithToolVoid(GetCallstackManager(cpuType), GetCallstack(callstackArray, callstackSize));
 	}
 
+	DllExport uint64_t __stdcall GetCallstackOverflowCount(CpuType cpuType) { return WithTool(uint64_t, GetCallstackManager(cpuType), GetOverflowCount()); }
+
 	DllExport void __stdcall GetProfilerData(CpuType cpuType, ProfiledFunction* profilerData, uint32_t& functionCount)
 	{
 		functionCount = 0;
@@ -106,6 +109,10 @@ extern "C"
 
 	DllExport void __stdcall ResetProfiler(CpuType cpuType) { WithToolVoid(GetCallstackManager(cpuType), GetProfiler()->Reset()); }
 
+	DllExport void __stdcall SetProfilerSamplingOptions(CpuType cpuType, bool enabled, uint32_t interval) { WithToolVoid(GetCallstackManager(cpuType), SetSamplingOptions(enabled, interval)); }
+	DllExport void __stdcall ResetSamplingProfiler(CpuType cpuType) { WithToolVoid(GetCallstackManager(cpuType), GetSamplingProfiler()->Reset()); }
+	DllExport bool __stdcall SaveProfilerFoldedStacks(CpuType cpuType, const char* filename) { return WithTool(bool, GetCallstackManager(cpuType), GetSamplingProfiler()->SaveFoldedStacks(filename)); }
+
 	DllExport void __stdcall GetConsoleState(BaseState& state, ConsoleType consoleType) { WithDebugger(void, GetConsoleState(state, consoleType)); }
 	DllExport void __stdcall GetCpuState(BaseState& state, CpuType cpuType) { WithDebugger(void, GetCpuState(state, cpuType)); }
 	DllExport void __stdcall GetPpuState(BaseState& state, CpuType cpuType) { WithDebugger(void, GetPpuState(state, cpuType)); }
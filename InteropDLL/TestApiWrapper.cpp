@@ -8,17 +8,17 @@ shared_ptr<RecordedRomTest> _recordedRomTest;
 
 extern "C"
 {
-	DllExport RomTestResult __stdcall RunRecordedTest(char* filename, bool inBackground)
+	DllExport RomTestResult __stdcall RunRecordedTest(char* filename, bool inBackground, bool withDebugger)
 	{
 		if(inBackground) {
 			unique_ptr<Emulator> emu(new Emulator());
 			emu->Initialize();
 			emu->GetSettings()->SetFlag(EmulationFlags::ConsoleMode);
 			shared_ptr<RecordedRomTest> romTest(new RecordedRomTest(emu.get(), true));
-			return romTest->Run(filename);
+			return romTest->Run(filename, withDebugger);
 		} else {
 			shared_ptr<RecordedRomTest> romTest(new RecordedRomTest(_emu.get(), false));
-			return romTest->Run(filename);
+			return romTest->Run(filename, withDebugger);
 		}
 	}
 
@@ -0,0 +1,74 @@
+-----------------------
+-- Checks emu.readBlock/emu.writeBlock, including reusing an existing table with readBlock's optional 4th parameter
+-- Usage: Mesen --testrunner <rom file> Tests/Lua/MemoryBlock.lua
+-- Works with any console - the test runner's exit code is 0 on success, or the number of the first check that failed
+-----------------------
+
+local ramTypes = { "snesWorkRam", "nesInternalRam", "gbWorkRam", "pceWorkRam", "smsWorkRam", "gbaIntWorkRam" }
+
+function findWorkRam()
+  for i, name in ipairs(ramTypes) do
+    local memType = emu.memType[name]
+    if memType ~= nil and emu.getMemorySize(memType) >= 0x100 then
+      return memType
+    end
+  end
+  return nil
+end
+
+function check(checkNumber, condition, message)
+  if not condition then
+    emu.log("Check " .. checkNumber .. " failed: " .. message)
+    emu.stop(checkNumber)
+    return false
+  end
+  return true
+end
+
+function runTests()
+  local memType = findWorkRam()
+  if not check(1, memType ~= nil, "no work ram found") then return end
+
+  local ramSize = emu.getMemorySize(memType)
+
+  --Write a known pattern and read it back into a new table
+  local values = {}
+  for i = 1, 16 do
+    values[i] = (i * 7) & 0xFF
+  end
+  emu.writeBlock(0x20, values, memType)
+
+  local result = emu.readBlock(0x20, 16, memType)
+  if not check(2, #result == 16, "readBlock returned " .. #result .. " values, expected 16") then return end
+  for i = 1, 16 do
+    if not check(3, result[i] == values[i], "value " .. i .. " is " .. tostring(result[i]) .. ", expected " .. values[i]) then return end
+  end
+
+  --Reuse the table with a shorter length, the same table must be returned without the extra values
+  local reused = emu.readBlock(0x24, 4, memType, result)
+  if not check(4, reused == result, "readBlock did not return the table that was passed in") then return end
+  if not check(5, #reused == 4, "reused table contains " .. #reused .. " values, expected 4") then return end
+  if not check(6, reused[5] == nil, "values past the new length were not removed") then return end
+  for i = 1, 4 do
+    if not check(7, reused[i] == values[i + 4], "reused value " .. i .. " is " .. tostring(reused[i]) .. ", expected " .. values[i + 4]) then return end
+  end
+
+  --Reuse the table with a longer length
+  reused = emu.readBlock(0x20, 16, memType, reused)
+  if not check(8, #reused == 16, "reused table contains " .. #reused .. " values, expected 16") then return end
+  for i = 1, 16 do
+    if not check(9, reused[i] == values[i], "reused value " .. i .. " is " .. tostring(reused[i]) .. ", expected " .. values[i]) then return end
+  end
+
+  --Reads stop at the end of the memory type
+  reused = emu.readBlock(ramSize - 2, 8, memType, reused)
+  if not check(10, #reused == 2, "read past the end returned " .. #reused .. " values, expected 2") then return end
+
+  --Writes past the end of the memory type are ignored
+  emu.writeBlock(ramSize - 1, { 0x12, 0x34 }, memType)
+  if not check(11, emu.read(ramSize - 1, memType) == 0x12, "last byte was not written") then return end
+
+  emu.stop(0)
+end
+
+emu.addEventCallback(runTests, emu.eventType.endFrame)
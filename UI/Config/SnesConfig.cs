@@ -54,6 +54,8 @@ namespace Mesen.Config
 		//Emulation
 		[Reactive] public bool EnableRandomPowerOnState { get; set; } = false;
 		[Reactive] public bool EnableStrictBoardMappings { get; set; } = false;
+		[Reactive] public bool EnableIdleLoopSkip { get; set; } = false;
+		[Reactive] public bool EnableParallelPpuRendering { get; set; } = false;
 		[Reactive] public RamState RamPowerOnState { get; set; } = RamState.Random;
 		[Reactive] [MinMax(-999, 999)] public Int32 SpcClockSpeedAdjustment { get; set; } = 40;
 
@@ -109,6 +111,8 @@ namespace Mesen.Config
 
 				EnableRandomPowerOnState = this.EnableRandomPowerOnState,
 				EnableStrictBoardMappings = this.EnableStrictBoardMappings,
+				EnableIdleLoopSkip = this.EnableIdleLoopSkip,
+				EnableParallelPpuRendering = this.EnableParallelPpuRendering,
 				PpuExtraScanlinesBeforeNmi = this.PpuExtraScanlinesBeforeNmi,
 				PpuExtraScanlinesAfterNmi = this.PpuExtraScanlinesAfterNmi,
 				GsuClockSpeed = this.GsuClockSpeed,
@@ -200,6 +204,8 @@ namespace Mesen.Config
 
 		[MarshalAs(UnmanagedType.I1)] public bool EnableRandomPowerOnState;
 		[MarshalAs(UnmanagedType.I1)] public bool EnableStrictBoardMappings;
+		[MarshalAs(UnmanagedType.I1)] public bool EnableIdleLoopSkip;
+		[MarshalAs(UnmanagedType.I1)] public bool EnableParallelPpuRendering;
 		public RamState RamPowerOnState;
 		public Int32 SpcClockSpeedAdjustment;
 
@@ -421,7 +421,12 @@ namespace Mesen.Interop
 			return callstack;
 		}
 
+		[DllImport(DllPath)] public static extern UInt64 GetCallstackOverflowCount(CpuType type);
+
 		[DllImport(DllPath)] public static extern void ResetProfiler(CpuType type);
+		[DllImport(DllPath)] public static extern void SetProfilerSamplingOptions(CpuType type, [MarshalAs(UnmanagedType.I1)] bool enabled, UInt32 interval);
+		[DllImport(DllPath)] public static extern void ResetSamplingProfiler(CpuType type);
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool SaveProfilerFoldedStacks(CpuType type, [MarshalAs(UnmanagedType.LPUTF8Str)] string filename);
 		[DllImport(DllPath, EntryPoint = "GetProfilerData")] private static extern void GetProfilerDataWrapper(CpuType type, IntPtr profilerData, ref UInt32 functionCount);
 		public static unsafe int GetProfilerData(CpuType type, ref ProfiledFunction[] profilerData)
 		{
@@ -21,7 +21,7 @@ namespace Mesen.Utilities
 		{
 			string? filename = await FileDialogHelper.OpenFile(ConfigManager.TestFolder, null, "mtp");
 			if(filename != null) {
-				RomTestResult result = TestApi.RunRecordedTest(filename, false);
+				RomTestResult result = TestApi.RunRecordedTest(filename, false, false);
 
 				string msg = "[Test] " + result.State.ToString();
 				if(result.State != RomTestState.Passed) {
@@ -44,9 +44,13 @@ namespace Mesen.Utilities
 				ConcurrentDictionary<string, RomTestResult> results = new();
 
 				List<string> testFiles = Directory.EnumerateFiles(ConfigManager.TestFolder, "*.mtp", SearchOption.AllDirectories).ToList();
-				Parallel.ForEach(testFiles, new ParallelOptions() { MaxDegreeOfParallelism = Environment.ProcessorCount - 2 }, (string testFile) => {
-					string entryName = testFile.Substring(ConfigManager.TestFolder.Length);
-					results[entryName] = TestApi.RunRecordedTest(testFile, true);
+
+				//Each test also runs with the debugger attached, which disables the shortcuts some cores take
+				//when no debugger is present (e.g SNES master clock skipping) - both runs must match the recording
+				List<(string file, bool withDebugger)> testRuns = testFiles.SelectMany(file => new[] { (file, false), (file, true) }).ToList();
+				Parallel.ForEach(testRuns, new ParallelOptions() { MaxDegreeOfParallelism = Environment.ProcessorCount - 2 }, (testRun) => {
+					string entryName = testRun.file.Substring(ConfigManager.TestFolder.Length) + (testRun.withDebugger ? " (debugger)" : "");
+					results[entryName] = TestApi.RunRecordedTest(testRun.file, true, testRun.withDebugger);
 				});
 
 				EmuApi.WriteLogEntry("==================");
@@ -73,10 +77,10 @@ namespace Mesen.Utilities
 						EmuApi.WriteLogEntry("  Failed: " + failedTest);
 					}
 					EmuApi.WriteLogEntry("==================");
-					EmuApi.WriteLogEntry("Tests passed: " + (testFiles.Count - failedTests.Count));
+					EmuApi.WriteLogEntry("Tests passed: " + (testRuns.Count - failedTests.Count));
 					EmuApi.WriteLogEntry("Tests failed: " + failedTests.Count);
 				} else {
-					EmuApi.WriteLogEntry("All " + testFiles.Count + " tests passed!");
+					EmuApi.WriteLogEntry("All " + testRuns.Count + " tests passed!");
 				}
 				EmuApi.WriteLogEntry("==================");
 
@@ -13,5 +13,5 @@ public:
 	static bool ReadPNG(string filename, vector<uint8_t> &pngData, uint32_t &pngWidth, uint32_t &pngHeight);
 
 	template<typename T>
-	static bool ReadPNG(vector<uint8_t> input, vector<T> &output, uint32_t &pngWidth, uint32_t &pngHeight);
+	static bool ReadPNG(const vector<uint8_t>& input, vector<T> &output, uint32_t &pngWidth, uint32_t &pngHeight);
 };
\ No newline at end of file